@@ -0,0 +1,522 @@
+/*
+ *  bench_kernels.c
+ *
+ *  Microbenchmarks for the transport and chemistry kernels.
+ *  Each case calls one kernel on fixed, representative data:
+ *    - advec_diff, space_advec_diff and discretize on rows of
+ *      12, 24, 200 and 600 cells,
+ *    - Update_RCONST, Fun, Jac_SP, KppDecomp and KppSolve
+ *      on a daytime cell, and the night-time kernels on a night cell,
+ *    - one Rosenbrock integration over STEP_SIZE seconds of a
+ *      daytime and a night-time cell.
+ *  The cells are the initial concentrations integrated for an hour
+ *  up to noon and midnight.  Each case is calibrated so one sample
+ *  takes at least MIN_SAMPLE seconds, warmed up for WARMUP samples
+ *  and then timed for the given number of samples.  The median,
+ *  minimum and spread of the time per call are reported, with the
+ *  cells and bytes per second they imply.  Bytes count the arrays
+ *  each call must read and write once, not cache traffic.
+ *
+ *  usage: bench_kernels [samples] [case]
+ *    Runs only the cases whose name contains [case], if given.
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <omp.h>
+
+#include "params.h"
+#include "discretize.h"
+
+#include "saprc99_Global.h"
+#include "saprc99_Sparse.h"
+
+/* Shortest sample and samples discarded before timing */
+#define MIN_SAMPLE 1.0e-3
+#define WARMUP     3
+#define MAX_SAMPLES 1000
+
+#define MAX_ROW 600
+
+/* Keeps results live */
+static volatile double sink;
+
+/* KPP-generated SAPRC'99 mechanism data */
+double * C;                 /* Concentration of all species */
+double * VAR;               /* First variable species */
+double * FIX;               /* First fixed species */
+double RCONST[NREACT];      /* Rate constants (global) */
+double ATOL[NVAR];          /* Absolute tolerance */
+double RTOL[NVAR];          /* Relative tolerance */
+double TIME;                /* Current integration time */
+double DT;                  /* Integration step */
+double SUN;                 /* Sunlight intensity between [0,1] */
+double TEMP;                /* Temperature */
+double STEPMIN;             /* Lower bound for integration step */
+
+#pragma omp threadprivate(C, VAR, FIX, RCONST, TIME, SUN, TEMP, DT)
+
+/**************************************************
+ * Timing                                         *
+ **************************************************/
+
+/* One benchmark case: runs the kernel iters times */
+typedef void (*kernel_t)(void *arg, long iters);
+
+static int compare_doubles(const void *a, const void *b)
+{
+    double x = *(const double*)a, y = *(const double*)b;
+    return x < y ? -1 : x > y;
+}
+
+/**
+ * Times one case and prints its statistics.
+ * cells and bytes are per call.
+ */
+static void bench(const char *name, const char *filter, int samples,
+                  kernel_t f, void *arg, double cells, double bytes)
+{
+    double t[MAX_SAMPLES];
+    double start, mean, sd, med;
+    long iters;
+    int s;
+
+    if(filter && !strstr(name, filter))
+        return;
+
+    /* Calibrate */
+    iters = 1;
+    while(1)
+    {
+        start = omp_get_wtime();
+        f(arg, iters);
+        if(omp_get_wtime() - start >= MIN_SAMPLE || iters > (1L << 30))
+            break;
+        iters *= 2;
+    }
+
+    for(s=0; s<WARMUP; s++)
+        f(arg, iters);
+
+    for(s=0; s<samples; s++)
+    {
+        start = omp_get_wtime();
+        f(arg, iters);
+        t[s] = (omp_get_wtime() - start) / iters * 1.0e9;
+    }
+
+    mean = 0.0;
+    for(s=0; s<samples; s++)
+        mean += t[s];
+    mean /= samples;
+    sd = 0.0;
+    for(s=0; s<samples; s++)
+        sd += (t[s] - mean) * (t[s] - mean);
+    sd = samples > 1 ? sqrt(sd / (samples - 1)) : 0.0;
+
+    qsort(t, samples, sizeof(double), compare_doubles);
+    med = samples % 2 ? t[samples/2] : 0.5 * (t[samples/2-1] + t[samples/2]);
+
+    printf("%-26s %12.1f %9.1f %9.1f %6.1f%% %12.4g %9.3f\n",
+           name, med, t[0], mean, mean > 0 ? 100.0*sd/mean : 0.0,
+           cells / med * 1.0e9, bytes / med);
+}
+
+/**************************************************
+ * Transport cases                                *
+ **************************************************/
+
+typedef struct row
+{
+    int n;
+    real_t c[MAX_ROW], w[MAX_ROW], d[MAX_ROW];
+    real_t cb[4], wb[4], db[4];
+    real_t out[MAX_ROW];
+} row_t;
+
+static void init_row(row_t *r, int n)
+{
+    int i;
+
+    r->n = n;
+    for(i=0; i<n; i++)
+    {
+        r->c[i] = (real_t)(O3_INIT * (1.0 + 0.1*sin(0.3*i)));
+        r->w[i] = (real_t)(WIND_U_INIT * cos(0.1*i));
+        r->d[i] = (real_t)DIFF_H_INIT;
+    }
+    for(i=0; i<4; i++)
+    {
+        r->cb[i] = (real_t)O3_INIT;
+        r->wb[i] = (real_t)WIND_U_INIT;
+        r->db[i] = (real_t)DIFF_H_INIT;
+    }
+}
+
+static void run_advec_diff(void *arg, long iters)
+{
+    row_t *r = (row_t*)arg;
+    real_t acc = 0;
+    long k;
+    int i;
+
+    for(k=0; k<iters; k++)
+    {
+        i = 2 + (int)(k % (r->n - 4));
+        acc += advec_diff(DX,
+                          r->c[i-2], r->w[i-2], r->d[i-2],
+                          r->c[i-1], r->w[i-1], r->d[i-1],
+                          r->c[i],   r->w[i],   r->d[i],
+                          r->c[i+1], r->w[i+1], r->d[i+1],
+                          r->c[i+2], r->w[i+2], r->d[i+2]);
+    }
+    sink = acc;
+}
+
+static void run_space_advec_diff(void *arg, long iters)
+{
+    row_t *r = (row_t*)arg;
+    long k;
+
+    for(k=0; k<iters; k++)
+        space_advec_diff(r->n, r->c, r->w, r->d, r->cb, r->wb, r->db, DX, r->out);
+    sink = r->out[r->n/2];
+}
+
+static void run_discretize(void *arg, long iters)
+{
+    row_t *r = (row_t*)arg;
+    long k;
+
+    for(k=0; k<iters; k++)
+        discretize(r->n, r->c, r->w, r->d, r->cb, r->wb, r->db, DX, STEP_SIZE, r->out);
+    sink = r->out[r->n/2];
+}
+
+/**************************************************
+ * Chemistry cases                                *
+ **************************************************/
+
+#if DO_CHEMISTRY == 1
+
+void saprc99_Initialize(double C[NSPEC]);
+void Update_SUN();
+void Update_RCONST();
+void Fun(double V[], double F[], double RCT[], double Vdot[]);
+void Fun_Dark(double V[], double F[], double RCT[], double Vdot[]);
+void Jac_SP(double V[], double F[], double RCT[], double JVS[]);
+void Jac_SP_Dark(double V[], double F[], double RCT[], double JVS[]);
+int  KppDecomp(double A[]);
+void KppSolve(double A[], double b[]);
+int Rosenbrock(double Y[], double Tstart, double Tend,
+               double AbsTol[], double RelTol[],
+               double RPAR[], int IPAR[]);
+
+/* One cell at a fixed time of day */
+typedef struct cell
+{
+    double t;
+    double conc[NSPEC];
+    double work[NSPEC];
+    double rconst[NREACT];
+    double vdot[NVAR];
+    double jvs[LU_NONZERO];
+    double lu[LU_NONZERO];
+    double rhs[NVAR];
+    long nstp;
+    long calls;
+} cell_t;
+
+/**
+ * Sets the KPP globals for a cell at time t
+ */
+static void set_time(cell_t *c, double t)
+{
+    TIME = t;
+    Update_SUN();
+    Update_RCONST();
+    memcpy(c->rconst, RCONST, sizeof(RCONST));
+}
+
+/**
+ * Integrates over dt from the cell's state with the
+ * parameters the model uses
+ */
+static int integrate(double *conc, double t, double dt, int *nstp)
+{
+    double RPAR[20];
+    int IPAR[21];
+    int i, ierr;
+
+    for(i=0; i<20; i++)
+    {
+        IPAR[i] = 0;
+        RPAR[i] = 0.0;
+    }
+    IPAR[20] = 0;
+    IPAR[1] = 1;
+    RPAR[2] = STEPMIN;
+    IPAR[3] = 5;
+    IPAR[4] = CHEM_MIXED_LU;
+
+    C   = conc;
+    VAR = conc;
+    FIX = &conc[NFIXST];
+    ierr = Rosenbrock(VAR, t, t+dt, ATOL, RTOL, RPAR, IPAR);
+    if(nstp) *nstp = IPAR[12];
+
+    return ierr;
+}
+
+/**
+ * Initial concentrations integrated for an hour up to time t
+ */
+static void init_cell(cell_t *c, double t)
+{
+    int i;
+
+    STEPMIN = 0.01;
+    TEMP = TEMP_INIT;
+    for(i=0; i<NVAR; i++)
+    {
+        RTOL[i] = 1.0e-3;
+        ATOL[i] = 1.0;
+    }
+
+    saprc99_Initialize(c->conc);
+    if(integrate(c->conc, t - 3600.0, 3600.0, NULL) < 0)
+        fprintf(stderr, "Warning: spin-up integration failed\n");
+
+    c->t = t;
+    memcpy(c->work, c->conc, sizeof(c->conc));
+    C   = c->work;
+    VAR = c->work;
+    FIX = &c->work[NFIXST];
+    set_time(c, t);
+
+    /* A matrix as the integrator factors it: 1/(h*gamma) - J */
+    Jac_SP(VAR, FIX, RCONST, c->jvs);
+    for(i=0; i<LU_NONZERO; i++)
+        c->lu[i] = -c->jvs[i];
+    for(i=0; i<NVAR; i++)
+        c->lu[LU_DIAG[i]] += 1.0 / (STEP_SIZE * 0.25);
+    KppDecomp(c->lu);
+
+    c->nstp = 0;
+    c->calls = 0;
+}
+
+static void run_update_rconst(void *arg, long iters)
+{
+    cell_t *c = (cell_t*)arg;
+    long k;
+
+    for(k=0; k<iters; k++)
+    {
+        TIME = c->t;
+        Update_SUN();
+        Update_RCONST();
+    }
+    sink = RCONST[0];
+}
+
+static void run_fun(void *arg, long iters)
+{
+    cell_t *c = (cell_t*)arg;
+    long k;
+
+    for(k=0; k<iters; k++)
+        Fun(c->work, &c->work[NFIXST], c->rconst, c->vdot);
+    sink = c->vdot[0];
+}
+
+static void run_fun_dark(void *arg, long iters)
+{
+    cell_t *c = (cell_t*)arg;
+    long k;
+
+    for(k=0; k<iters; k++)
+        Fun_Dark(c->work, &c->work[NFIXST], c->rconst, c->vdot);
+    sink = c->vdot[0];
+}
+
+static void run_jac_sp(void *arg, long iters)
+{
+    cell_t *c = (cell_t*)arg;
+    long k;
+
+    for(k=0; k<iters; k++)
+        Jac_SP(c->work, &c->work[NFIXST], c->rconst, c->jvs);
+    sink = c->jvs[0];
+}
+
+static void run_jac_sp_dark(void *arg, long iters)
+{
+    cell_t *c = (cell_t*)arg;
+    long k;
+
+    for(k=0; k<iters; k++)
+        Jac_SP_Dark(c->work, &c->work[NFIXST], c->rconst, c->jvs);
+    sink = c->jvs[0];
+}
+
+static void run_kppdecomp(void *arg, long iters)
+{
+    cell_t *c = (cell_t*)arg;
+    double a[LU_NONZERO];
+    long k;
+    int i;
+
+    /* Factor a fresh copy each time */
+    for(k=0; k<iters; k++)
+    {
+        for(i=0; i<LU_NONZERO; i++)
+            a[i] = -c->jvs[i];
+        for(i=0; i<NVAR; i++)
+            a[LU_DIAG[i]] += 1.0 / (STEP_SIZE * 0.25);
+        KppDecomp(a);
+    }
+    sink = a[0];
+}
+
+static void run_kppsolve(void *arg, long iters)
+{
+    cell_t *c = (cell_t*)arg;
+    long k;
+
+    for(k=0; k<iters; k++)
+    {
+        memcpy(c->rhs, c->conc, sizeof(c->rhs));
+        KppSolve(c->lu, c->rhs);
+    }
+    sink = c->rhs[0];
+}
+
+static void run_rosenbrock(void *arg, long iters)
+{
+    cell_t *c = (cell_t*)arg;
+    long k;
+    int nstp;
+
+    for(k=0; k<iters; k++)
+    {
+        memcpy(c->work, c->conc, sizeof(c->work));
+        integrate(c->work, c->t, STEP_SIZE, &nstp);
+        c->nstp += nstp;
+        ++c->calls;
+    }
+    sink = c->work[0];
+}
+
+#endif
+
+int main(int argc, char** argv)
+{
+    int samples = 20;
+    char *filter = NULL;
+    char name[64];
+    int lens[] = {12, 24, 200, 600};
+    int i, n;
+    row_t *row;
+#if DO_CHEMISTRY == 1
+    cell_t *day, *night;
+    double v = sizeof(double);
+#endif
+
+    if(argc > 1) samples = atoi(argv[1]);
+    if(argc > 2) filter = argv[2];
+
+    if(samples < 1 || samples > MAX_SAMPLES)
+    {
+        fprintf(stderr, "usage: %s [samples (1..%d)] [case]\n", argv[0], MAX_SAMPLES);
+        return 1;
+    }
+
+    row = (row_t*)malloc(sizeof(row_t));
+    if(!row)
+    {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    printf("%d samples of at least %g sec after %d warmup samples, %s precision\n\n",
+           samples, MIN_SAMPLE, WARMUP, DOUBLE_PRECISION ? "double" : "single");
+    printf("%-26s %12s %9s %9s %7s %12s %9s\n",
+           "case", "median ns", "min ns", "mean ns", "sd", "cells/s", "GB/s");
+
+    /* Transport: one cell reads 3 values of 5 neighbors,
+     * a row reads 3 fields and writes one */
+    for(i=0; i<sizeof(lens)/sizeof(lens[0]); i++)
+    {
+        n = lens[i];
+        init_row(row, n);
+
+        sprintf(name, "advec_diff/%d", n);
+        bench(name, filter, samples, run_advec_diff, row,
+              1, 3*sizeof(real_t));
+        sprintf(name, "space_advec_diff/%d", n);
+        bench(name, filter, samples, run_space_advec_diff, row,
+              n, (4.0*n + 12) * sizeof(real_t));
+        sprintf(name, "discretize/%d", n);
+        bench(name, filter, samples, run_discretize, row,
+              n, (4.0*n + 12) * sizeof(real_t));
+    }
+
+#if DO_CHEMISTRY == 1
+    day   = (cell_t*)malloc(sizeof(cell_t));
+    night = (cell_t*)malloc(sizeof(cell_t));
+    if(!day || !night)
+    {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    init_cell(day, 12*3600.0);
+    init_cell(night, 24*3600.0);
+
+    /* Chemistry: one cell per call */
+    C   = day->work;
+    VAR = day->work;
+    FIX = &day->work[NFIXST];
+    bench("Update_RCONST", filter, samples, run_update_rconst, day,
+          1, NREACT*v);
+    bench("Fun/day", filter, samples, run_fun, day,
+          1, (NSPEC + NREACT + NVAR)*v);
+    bench("Jac_SP/day", filter, samples, run_jac_sp, day,
+          1, (NSPEC + NREACT + LU_NONZERO)*v);
+    bench("KppDecomp/day", filter, samples, run_kppdecomp, day,
+          1, 3*LU_NONZERO*v);
+    bench("KppSolve/day", filter, samples, run_kppsolve, day,
+          1, (LU_NONZERO + 3*NVAR)*v);
+    bench("Fun/night", filter, samples, run_fun, night,
+          1, (NSPEC + NREACT + NVAR)*v);
+    bench("Fun_Dark/night", filter, samples, run_fun_dark, night,
+          1, (NSPEC + NREACT + NVAR)*v);
+    bench("Jac_SP_Dark/night", filter, samples, run_jac_sp_dark, night,
+          1, (NSPEC + NREACT + LU_NONZERO)*v);
+    bench("Rosenbrock/day", filter, samples, run_rosenbrock, day,
+          1, 2*NSPEC*v);
+    bench("Rosenbrock/night", filter, samples, run_rosenbrock, night,
+          1, 2*NSPEC*v);
+
+    if(day->calls && night->calls)
+        printf("\nRosenbrock steps per call over %d sec: day %.1f, night %.1f\n",
+               STEP_SIZE, (double)day->nstp / day->calls,
+               (double)night->nstp / night->calls);
+
+    free(day);
+    free(night);
+#else
+    printf("\nChemistry cases need DO_CHEMISTRY 1\n");
+#endif
+
+    free(row);
+
+    return 0;
+}
@@ -0,0 +1,55 @@
+#!/bin/bash
+#
+# Builds fixedgrid once for each concentration layout and
+# compares the time per timestep.
+#
+# usage: ./bench_layouts.sh [threads] [fixedgrid options] [-- make options]
+#   e.g. ./bench_layouts.sh 8 -unsplit -- CC=gcc LD=gcc CFLAGS="-O3 -fopenmp" LDFLAGS="-fopenmp -lm"
+#
+
+NPROCS=${1:-1}
+shift
+
+ARGS=""
+while [ $# -gt 0 ] && [ "$1" != "--" ] ; do
+	ARGS="$ARGS $1"
+	shift
+done
+[ "$1" == "--" ] && shift
+
+NAMES=("species-outer" "cell-outer" "blocked")
+
+# Keep the user's DEFS apart so they add to ours instead of replacing them
+USER_DEFS=""
+MAKE_ARGS=()
+for arg in "$@" ; do
+	case "$arg" in
+		DEFS=*) USER_DEFS="$USER_DEFS ${arg#DEFS=}" ;;
+		*)      MAKE_ARGS+=("$arg") ;;
+	esac
+done
+
+mkdir -p Output
+
+for layout in 0 1 2 ; do
+	echo -n "Building layout $layout (${NAMES[$layout]})..."
+	make clean > /dev/null
+	make DEFS="-DCONC_LAYOUT=$layout$USER_DEFS" "${MAKE_ARGS[@]}" > Output/build_layout$layout.out 2>&1 || { echo " failed!" ; exit 1 ; }
+	cp fixedgrid Output/fixedgrid_layout$layout
+	echo " done!"
+done
+make clean > /dev/null
+
+printf "\n%-14s %8s %12s %12s %12s %12s %12s %12s\n" "Layout" "Steps" "Sec/step" "X discret" "Y discret" "Z discret" "Chemistry" "Unsplit"
+for layout in 0 1 2 ; do
+	Output/fixedgrid_layout$layout $NPROCS $ARGS > Output/fixedgrid_layout$layout.out 2>&1
+	awk -v name=${NAMES[$layout]} '
+		/^Timesteps:/    { steps = $2 }
+		split($0, f, ":") == 2 && f[2] ~ /^ *[0-9.]+ +[0-9]+ / {
+			sub(/^ +/, "", f[1]) ; sub(/ +$/, "", f[1])
+			t[f[1]] += f[2]
+		}
+		END { printf("%-14s %8d %12.6f %12.6f %12.6f %12.6f %12.6f %12.6f\n", name, steps, t["Wallclock"]/steps,
+		             t["X discret"], t["Y discret"], t["Z discret"], t["Chemistry"], t["Unsplit"]) }
+	' Output/fixedgrid_layout$layout.out
+done
@@ -0,0 +1,365 @@
+/*
+ *  bench_replay.c
+ *
+ *  Replays the chemistry cells captured by "fixedgrid -capture".
+ *  Every captured cell is integrated again from its recorded state,
+ *  time, temperature, length and starting step, with the integrator
+ *  as built and the method, LU precision, tolerances and starting
+ *  step chosen on the command line.  The records are shared among
+ *  the OpenMP threads and the whole set is integrated repeat times.
+ *  Reported are:
+ *    - the throughput of the fastest and median pass,
+ *    - the distribution of steps and rejected steps per cell,
+ *      recorded and replayed,
+ *    - the largest deviation of the replayed concentrations from
+ *      the recorded ones, relative and in tolerance units.
+ *  Replaying with the settings and build the cells were captured
+ *  with reproduces them exactly; variants built with other options
+ *  or run with other settings are measured against the same cells.
+ *  The Makefile doesn't track DEFS, so build a variant from clean
+ *  objects and with chemistry on:
+ *
+ *    make clean
+ *    make bench_replay DEFS="-DDO_CHEMISTRY=1 -DCHEM_FUSED_FUNJAC=0"
+ *
+ *  usage: bench_replay file [-method n] [-mixed 0|1] [-cold]
+ *                           [-rtol r] [-atol a] [-repeat n]
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <omp.h>
+
+#include "params.h"
+#include "chemcapture.h"
+
+#include "saprc99_Global.h"
+#include "saprc99_Monitor.h"
+
+/* Most passes over the records */
+#define MAX_REPEAT 100
+
+/* Buckets of the step histogram: 1, 2, 3-4, 5-8, ... */
+#define HIST_BUCKETS 8
+
+/* KPP-generated SAPRC'99 mechanism data */
+double * C;                 /* Concentration of all species */
+double * VAR;               /* First variable species */
+double * FIX;               /* First fixed species */
+double RCONST[NREACT];      /* Rate constants (global) */
+double ATOL[NVAR];          /* Absolute tolerance */
+double RTOL[NVAR];          /* Relative tolerance */
+double TIME;                /* Current integration time */
+double DT;                  /* Integration step */
+double SUN;                 /* Sunlight intensity between [0,1] */
+double TEMP;                /* Temperature */
+double STEPMIN;             /* Lower bound for integration step */
+
+#pragma omp threadprivate(C, VAR, FIX, RCONST, TIME, SUN, TEMP, DT)
+
+#if DO_CHEMISTRY == 1
+
+int Rosenbrock(double Y[], double Tstart, double Tend,
+               double AbsTol[], double RelTol[],
+               double RPAR[], int IPAR[]);
+
+/* Integrator settings of a replay */
+typedef struct variant
+{
+    int method;
+    int mixed_lu;
+    int cold;               /* Start every cell from STEPMIN */
+    double atol;
+    double rtol;
+} variant_t;
+
+/* Outcome of replaying one cell */
+typedef struct result
+{
+    int32_t nstp;
+    int32_t nrej;
+    int32_t ierr;
+    int32_t worst;          /* Species of largest relative deviation */
+    double rel;             /* Largest relative deviation */
+    double tol;             /* Largest deviation in tolerance units */
+} result_t;
+
+static int compare_doubles(const void *a, const void *b)
+{
+    double x = *(const double*)a, y = *(const double*)b;
+    return x < y ? -1 : x > y;
+}
+
+static int compare_ints(const void *a, const void *b)
+{
+    int32_t x = *(const int32_t*)a, y = *(const int32_t*)b;
+    return x < y ? -1 : x > y;
+}
+
+/**
+ * Integrates one captured cell and compares it with the recorded output
+ */
+static void replay(capture_record_t* r, variant_t* v, result_t* res)
+{
+    double RPAR[20];
+    int IPAR[21];
+    double conc[NSPEC];
+    double d, ref, rel, tol;
+    int i;
+
+    for(i=0; i<20; i++)
+    {
+        IPAR[i] = 0;
+        RPAR[i] = 0.0;
+    }
+    IPAR[20] = 0;
+    IPAR[1] = 1;            /* scalar tolerances */
+    IPAR[3] = v->method;
+    IPAR[4] = v->mixed_lu;
+    RPAR[2] = v->cold ? STEPMIN : r->hstart;
+
+    memcpy(conc, r->in, sizeof(conc));
+    C   = conc;
+    VAR = conc;
+    FIX = &conc[NFIXST];
+    TIME = r->time;
+    DT = r->dt;
+    TEMP = r->temp;
+
+    res->ierr = Rosenbrock(VAR, TIME, TIME+DT, ATOL, RTOL, RPAR, IPAR);
+    res->nstp = IPAR[12];
+    res->nrej = IPAR[14];
+
+    /* Fixed species don't change */
+    res->rel = 0.0;
+    res->tol = 0.0;
+    res->worst = 0;
+    for(i=0; i<NVAR; i++)
+    {
+        ref = r->out[i];
+        d = fabs(conc[i] - ref);
+        rel = d / (fabs(ref) > v->atol ? fabs(ref) : v->atol);
+        tol = d / (v->atol + v->rtol*fabs(ref));
+        if(rel > res->rel)
+        {
+            res->rel = rel;
+            res->worst = i;
+        }
+        if(tol > res->tol)
+            res->tol = tol;
+    }
+}
+
+/**
+ * Prints the distribution of n counts
+ */
+static void print_counts(char* name, int32_t* counts, int32_t n)
+{
+    double sum = 0.0;
+    int32_t i, nonzero = 0;
+
+    for(i=0; i<n; i++)
+    {
+        sum += counts[i];
+        if(counts[i] > 0) ++nonzero;
+    }
+
+    qsort(counts, n, sizeof(int32_t), compare_ints);
+
+    printf("  %-16s %8.2f %6d %6d %6d %6d %6d %8.1f%%\n", name, sum/n,
+           counts[0], counts[n/2], counts[(int32_t)(0.9*(n-1))], counts[(int32_t)(0.99*(n-1))],
+           counts[n-1], 100.0*nonzero/n);
+}
+
+/**
+ * Adds n step counts to a histogram of log2 buckets
+ */
+static void add_hist(int32_t* hist, int32_t* counts, int32_t n)
+{
+    int32_t i, b, k;
+
+    for(i=0; i<n; i++)
+    {
+        for(b=0, k=1; b<HIST_BUCKETS-1 && counts[i] > k; b++, k*=2);
+        ++hist[b];
+    }
+}
+
+#endif
+
+int main(int argc, char** argv)
+{
+#if DO_CHEMISTRY == 1
+    capture_header_t h;
+    capture_record_t* recs;
+    result_t* res;
+    variant_t v;
+    int32_t* counts;
+    int32_t hist_rec[HIST_BUCKETS], hist_rep[HIST_BUCKETS];
+    double t[MAX_REPEAT];
+    double start, best, med, steps;
+    int repeat = 3;
+    int usage = 0;
+    int32_t i, n, fails, over, worst;
+    int p, b, k;
+    char* fname = NULL;
+
+    v.method = 0;
+    v.mixed_lu = -1;
+    v.cold = 0;
+    v.atol = 0.0;
+    v.rtol = 0.0;
+
+    for(i=1; i<argc; i++)
+    {
+        if(!strcmp(argv[i], "-method") && i+1 < argc)
+            v.method = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "-mixed") && i+1 < argc)
+            v.mixed_lu = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "-cold"))
+            v.cold = 1;
+        else if(!strcmp(argv[i], "-rtol") && i+1 < argc)
+            v.rtol = atof(argv[++i]);
+        else if(!strcmp(argv[i], "-atol") && i+1 < argc)
+            v.atol = atof(argv[++i]);
+        else if(!strcmp(argv[i], "-repeat") && i+1 < argc)
+            repeat = atoi(argv[++i]);
+        else if(argv[i][0] != '-' && !fname)
+            fname = argv[i];
+        else
+            usage = 1;
+    }
+
+    if(usage || !fname || repeat < 1 || repeat > MAX_REPEAT || v.method < 0 || v.method > 5)
+    {
+        fprintf(stderr, "usage: %s file [-method 1..5] [-mixed 0|1] [-cold] [-rtol r] [-atol a] [-repeat 1..%d]\n",
+                argv[0], MAX_REPEAT);
+        return 1;
+    }
+
+    if(!(recs = capture_read(fname, &h)))
+        return 1;
+    n = h.count;
+    if(n < 1)
+    {
+        fprintf(stderr, "%s has no records.\n", fname);
+        return 1;
+    }
+
+    /* Unset options replay the captured settings */
+    if(v.method == 0) v.method = h.method;
+    if(v.mixed_lu < 0) v.mixed_lu = h.mixed_lu;
+    if(v.atol <= 0.0) v.atol = h.atol;
+    if(v.rtol <= 0.0) v.rtol = h.rtol;
+
+    STEPMIN = h.stepmin;
+    for(i=0; i<NVAR; i++)
+    {
+        ATOL[i] = v.atol;
+        RTOL[i] = v.rtol;
+    }
+
+    res = (result_t*)malloc(sizeof(result_t)*n);
+    counts = (int32_t*)malloc(sizeof(int32_t)*n);
+    if(!res || !counts)
+    {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    printf("%d cells from %s, %d threads\n", n, fname, omp_get_max_threads());
+    printf("Captured: method %d, mixed LU %d, warm start %d, atol %g, rtol %g\n",
+           h.method, h.mixed_lu, h.warm_start, h.atol, h.rtol);
+    printf("Replayed: method %d, mixed LU %d, %s start, atol %g, rtol %g\n\n",
+           v.method, v.mixed_lu, v.cold ? "cold" : "captured", v.atol, v.rtol);
+
+    for(p=0; p<repeat; p++)
+    {
+        start = omp_get_wtime();
+        #pragma omp parallel for schedule(dynamic, 4)
+        for(i=0; i<n; i++)
+            replay(&recs[i], &v, &res[i]);
+        t[p] = omp_get_wtime() - start;
+    }
+
+    qsort(t, repeat, sizeof(double), compare_doubles);
+    best = t[0];
+    med = repeat % 2 ? t[repeat/2] : 0.5 * (t[repeat/2-1] + t[repeat/2]);
+
+    steps = 0.0;
+    for(i=0; i<n; i++)
+        steps += res[i].nstp;
+
+    printf("%-18s %12s %12s %12s\n", "Pass", "sec", "cells/s", "us/cell");
+    printf("%-18s %12.4f %12.4g %12.2f\n", "fastest", best, n/best, 1.0e6*best/n);
+    printf("%-18s %12.4f %12.4g %12.2f\n", "median", med, n/med, 1.0e6*med/n);
+    printf("%-18s %12s %12.4g\n", "steps/s (fastest)", "", steps/best);
+
+    /* Step distributions */
+    printf("\n  %-16s %8s %6s %6s %6s %6s %6s %9s\n", "Per cell", "mean", "min", "p50", "p90", "p99", "max", "nonzero");
+    for(b=0; b<HIST_BUCKETS; b++)
+        hist_rec[b] = hist_rep[b] = 0;
+
+    for(i=0; i<n; i++) counts[i] = recs[i].nstp;
+    add_hist(hist_rec, counts, n);
+    print_counts("Nstp captured", counts, n);
+    for(i=0; i<n; i++) counts[i] = res[i].nstp;
+    add_hist(hist_rep, counts, n);
+    print_counts("Nstp replayed", counts, n);
+    for(i=0; i<n; i++) counts[i] = recs[i].nrej;
+    print_counts("Nrej captured", counts, n);
+    for(i=0; i<n; i++) counts[i] = res[i].nrej;
+    print_counts("Nrej replayed", counts, n);
+
+    printf("\n  %-16s %10s %10s\n", "Nstp", "captured", "replayed");
+    for(b=0, k=1; b<HIST_BUCKETS; b++, k*=2)
+    {
+        char label[32];
+        if(b == HIST_BUCKETS-1)
+            sprintf(label, "> %d", k/2);
+        else if(k <= 2)
+            sprintf(label, "%d", k);
+        else
+            sprintf(label, "%d-%d", k/2+1, k);
+        printf("  %-16s %10d %10d\n", label, hist_rec[b], hist_rep[b]);
+    }
+
+    /* Deviation from the captured outputs */
+    fails = 0;
+    over = 0;
+    worst = 0;
+    for(i=0; i<n; i++)
+    {
+        if(res[i].ierr < 0) ++fails;
+        if(res[i].tol > 1.0) ++over;
+        if(res[i].rel > res[worst].rel) worst = i;
+    }
+
+    if(res[worst].rel > 0.0)
+        printf("\nMax relative deviation %.3e (%s in cell %d,%d,%d at t=%.0f)\n",
+               res[worst].rel, SPC_NAMES[res[worst].worst],
+               recs[worst].x, recs[worst].y, recs[worst].z, recs[worst].time);
+    else
+        printf("\nMax relative deviation 0 (captured outputs reproduced exactly)\n");
+    for(i=0, worst=0; i<n; i++)
+        if(res[i].tol > res[worst].tol) worst = i;
+    printf("Max deviation in tolerance units (atol + rtol*|c|) %.3e\n", res[worst].tol);
+    printf("Cells beyond tolerance: %d of %d\n", over, n);
+    if(fails)
+        printf("Failed integrations: %d\n", fails);
+
+    free(counts);
+    free(res);
+    free(recs);
+#else
+    printf("bench_replay needs DO_CHEMISTRY 1\n");
+#endif
+
+    return 0;
+}
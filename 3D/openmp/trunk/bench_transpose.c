@@ -0,0 +1,138 @@
+/*
+ *  bench_transpose.c
+ *
+ *  Microbenchmark for the grid <-> chemistry batch transposes.
+ *  Moves a species-outer array of ncells x nspec values into
+ *  cell-major batches and back, first with the naive per-cell
+ *  strided loop and then with the blocked transposes for several
+ *  batch sizes, and reports the sustained bandwidth of each.
+ *
+ *  usage: bench_transpose [ncells] [nspec] [reps]
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "transpose.h"
+#include "timer.h"
+
+#define MAX_BATCH 128
+
+/**
+ * Naive gather/scatter: one cell at a time, one species at a time
+ */
+static void naive(real_t *grid, int ncells, int nspec, int batch, double *blk)
+{
+    int x0, n, i, s;
+
+    for(x0=0; x0<ncells; x0+=batch)
+    {
+        n = ncells - x0 < batch ? ncells - x0 : batch;
+        for(i=0; i<n; i++)
+            for(s=0; s<nspec; s++)
+                blk[i*nspec + s] = grid[s*ncells + x0+i];
+        for(i=0; i<n; i++)
+            for(s=0; s<nspec; s++)
+                grid[s*ncells + x0+i] = blk[i*nspec + s];
+    }
+}
+
+/**
+ * Blocked gather/scatter through the tiled transposes
+ */
+static void blocked(real_t *grid, int ncells, int nspec, int batch, double *blk)
+{
+    int x0, n;
+
+    for(x0=0; x0<ncells; x0+=batch)
+    {
+        n = ncells - x0 < batch ? ncells - x0 : batch;
+        transpose_to_double(nspec, n, &grid[x0], ncells, blk, nspec);
+        transpose_from_double(n, nspec, blk, nspec, &grid[x0], ncells);
+    }
+}
+
+/**
+ * Runs one variant and prints its bandwidth
+ */
+static void run(const char *name,
+                void (*f)(real_t*, int, int, int, double*),
+                real_t *grid, int ncells, int nspec, int batch, int reps,
+                double *blk)
+{
+    int r;
+    float t;
+    double bytes;
+
+    /* Warm up */
+    f(grid, ncells, nspec, batch, blk);
+
+    t = elapsed_time();
+    for(r=0; r<reps; r++)
+        f(grid, ncells, nspec, batch, blk);
+    t = elapsed_time() - t;
+
+    /* Each value is read and written once in each direction */
+    bytes = (double)reps * ncells * nspec * 2.0 * (sizeof(real_t) + sizeof(double));
+
+    printf("%-8s batch %4d: %8.4f sec  %8.3f GB/s\n",
+           name, batch, t, t > 0 ? bytes / t / 1.0e9 : 0.0);
+}
+
+int main(int argc, char** argv)
+{
+    int ncells = 65536;
+    int nspec  = 79;
+    int reps   = 20;
+    int i, b;
+    real_t *grid;
+    double *blk;
+    double sum;
+
+    int batches[] = {8, 16, 32, 64, MAX_BATCH};
+
+    if(argc > 1) ncells = atoi(argv[1]);
+    if(argc > 2) nspec  = atoi(argv[2]);
+    if(argc > 3) reps   = atoi(argv[3]);
+
+    if(ncells < 1 || nspec < 1 || reps < 1)
+    {
+        fprintf(stderr, "usage: %s [ncells] [nspec] [reps]\n", argv[0]);
+        return 1;
+    }
+
+    grid = (real_t*)malloc(sizeof(real_t)*ncells*nspec);
+    blk  = (double*)malloc(sizeof(double)*MAX_BATCH*nspec);
+    if(!grid || !blk)
+    {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    for(i=0; i<ncells*nspec; i++)
+        grid[i] = (real_t)(i % 1000) * 1.0e-3;
+
+    printf("%d cells x %d species, %d reps, %.1f MB grid\n\n",
+           ncells, nspec, reps, sizeof(real_t)*ncells*nspec / 1.0e6);
+
+    for(b=0; b<sizeof(batches)/sizeof(batches[0]); b++)
+    {
+        run("naive", naive, grid, ncells, nspec, batches[b], reps, blk);
+        run("blocked", blocked, grid, ncells, nspec, batches[b], reps, blk);
+    }
+
+    /* Keep the result live */
+    sum = 0.0;
+    for(i=0; i<ncells*nspec; i++)
+        sum += grid[i];
+    printf("\nChecksum: %g\n", sum);
+
+    free(grid);
+    free(blk);
+
+    return 0;
+}
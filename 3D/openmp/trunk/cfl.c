@@ -0,0 +1,192 @@
+/*
+ *  cfl.c
+ *
+ *  Transport stability (CFL) controller.
+ *
+ *  A sweep of length dt along an axis with cell size h is stable when
+ *      |wind|*dt/h / COURANT_MAX + diff*dt/h^2 / DIFFNUM_MAX <= 1
+ *  Sweeps that would violate this are split into substeps.
+ *  With ADAPTIVE_STEP the timestep itself is chosen so that the
+ *  horizontal sweeps never need substeps; the z sweep is subcycled
+ *  column by column where needed.  With IMPLICIT_Z_DIFFUSION only
+ *  vertical advection counts toward the z substeps.
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#include <stdio.h>
+#include <math.h>
+
+#include "cfl.h"
+
+/**
+ * Resets the controller
+ */
+void cfl_init(fixedgrid_t* G)
+{
+    int i;
+
+    for(i=0; i<3; i++)
+    {
+        G->cfl.adv_rate[i] = 0.0;
+        G->cfl.diff_rate[i] = 0.0;
+        G->cfl.dt_stable[i] = STEP_SIZE_MAX;
+    }
+    G->cfl.dt_min = STEP_SIZE_MAX;
+    G->cfl.dt_max = 0.0;
+    G->cfl.stale = TRUE;
+}
+
+/**
+ * Returns the number of substeps needed to cover dt stably
+ * given the largest advection and diffusion rates on an axis.
+ */
+uint32_t cfl_steps(real_t adv_rate, real_t diff_rate, real_t dt)
+{
+    real_t r;
+
+    r = dt*adv_rate / COURANT_MAX + dt*diff_rate / DIFFNUM_MAX;
+
+    if(r <= 1.0) return 1;
+    return (uint32_t)ceil(r);
+}
+
+/**
+ * Returns the number of substeps needed to cover dt stably on a line
+ */
+uint32_t cfl_substeps(const int n, real_t *wind, real_t *diff,
+                      real_t cell_size, real_t dt)
+{
+    int i;
+    real_t w, a, d;
+
+    a = 0.0;
+    d = 0.0;
+    for(i=0; i<n; i++)
+    {
+        w = fabs(wind[i]);
+        if(w > a) a = w;
+        if(diff[i] > d) d = diff[i];
+    }
+
+    return cfl_steps(a / cell_size, d / (cell_size*cell_size), dt);
+}
+
+/**
+ * Computes the largest advection and diffusion rates on each axis
+ */
+void cfl_measure(fixedgrid_t* G)
+{
+    int32_t x, y, z, i;
+    real_t r;
+
+    real_t ux = 0.0, uy = 0.0, uz = 0.0;
+    real_t kh = 0.0, kv = 0.0;
+
+    #pragma omp parallel for private(z, y, x) reduction(max: ux, uy, uz, kh, kv)
+    for(z=0; z<NZ; z++)
+    {
+        for(y=0; y<NY; y++)
+        {
+            for(x=0; x<NX; x++)
+            {
+                if(fabs(G->wind_u(x, y, z)) > ux) ux = fabs(G->wind_u(x, y, z));
+                if(fabs(G->wind_v(x, y, z)) > uy) uy = fabs(G->wind_v(x, y, z));
+                if(fabs(G->wind_w(x, y, z)) > uz) uz = fabs(G->wind_w(x, y, z));
+                if(G->diff_h(x, y, z) > kh) kh = G->diff_h(x, y, z);
+                if(G->diff_v(x, y, z) > kv) kv = G->diff_v(x, y, z);
+            }
+        }
+    }
+
+    G->cfl.adv_rate[X_AXIS] = ux / DX;
+    G->cfl.adv_rate[Y_AXIS] = uy / DY;
+    G->cfl.adv_rate[Z_AXIS] = uz / DZ;
+    G->cfl.diff_rate[X_AXIS] = kh / (DX*DX);
+    G->cfl.diff_rate[Y_AXIS] = kh / (DY*DY);
+#if IMPLICIT_Z_DIFFUSION == 1
+    /* Backward Euler is unconditionally stable */
+    G->cfl.diff_rate[Z_AXIS] = 0.0;
+#else
+    G->cfl.diff_rate[Z_AXIS] = kv / (DZ*DZ);
+#endif
+
+    for(i=0; i<3; i++)
+    {
+        r = G->cfl.adv_rate[i] / COURANT_MAX + G->cfl.diff_rate[i] / DIFFNUM_MAX;
+        G->cfl.dt_stable[i] = r > 0.0 ? 1.0 / r : STEP_SIZE_MAX;
+    }
+
+    G->cfl.stale = FALSE;
+}
+
+/**
+ * Refreshes the stability rates when the met fields have changed
+ * and, with ADAPTIVE_STEP, chooses the timestep for the next step.
+ */
+void cfl_update(fixedgrid_t* G)
+{
+    real_t dt;
+
+    if(G->cfl.stale || G->met_update)
+        cfl_measure(G);
+
+#if ADAPTIVE_STEP == 1
+
+    dt = STEP_SIZE_MAX;
+
+    /* x sweeps cover dt/2, or dt when half-steps are merged */
+    #if MERGE_HALF_STEPS == 1
+    if(G->cfl.dt_stable[X_AXIS] < dt) dt = G->cfl.dt_stable[X_AXIS];
+    #else
+    if(2.0*G->cfl.dt_stable[X_AXIS] < dt) dt = 2.0*G->cfl.dt_stable[X_AXIS];
+    #endif
+
+    /* y sweeps cover dt/2 */
+    if(2.0*G->cfl.dt_stable[Y_AXIS] < dt) dt = 2.0*G->cfl.dt_stable[Y_AXIS];
+
+    /* z is subcycled per column and does not limit dt */
+
+    /* Land exactly on the end time */
+    if(G->time + dt > G->tend) dt = G->tend - G->time;
+
+    G->dt = dt;
+
+#else
+
+    dt = G->dt;
+
+#endif
+
+    if(dt < G->cfl.dt_min) G->cfl.dt_min = dt;
+    if(dt > G->cfl.dt_max) G->cfl.dt_max = dt;
+}
+
+/**
+ * Displays the Courant and diffusion numbers for the current timestep
+ */
+void print_cfl(fixedgrid_t* G)
+{
+    int i;
+    char axis[3] = {'X', 'Y', 'Z'};
+    real_t sweep[3];
+
+    /* Length of each sweep in a Strang-split step */
+    sweep[X_AXIS] = G->dt*0.5;
+    sweep[Y_AXIS] = G->dt*0.5;
+    sweep[Z_AXIS] = G->dt;
+
+    printf("STABILITY (dt = %.2f sec):\n", G->dt);
+    for(i=0; i<3; i++)
+    {
+        printf("    %c: COURANT %f  DIFFUSION %f  MAX STABLE SWEEP %.2f sec  SUBSTEPS %d\n",
+               axis[i],
+               G->cfl.adv_rate[i]*sweep[i],
+               G->cfl.diff_rate[i]*sweep[i],
+               G->cfl.dt_stable[i],
+               cfl_steps(G->cfl.adv_rate[i], G->cfl.diff_rate[i], sweep[i]));
+    }
+    printf("\n");
+}
@@ -0,0 +1,42 @@
+/*
+ *  cfl.h
+ *
+ *  Transport stability (CFL) controller.
+ *  Computes the Courant and diffusion numbers of the wind and
+ *  diffusion fields and chooses stable timesteps and substeps.
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#ifndef __CFL_H__
+#define __CFL_H__
+
+/**************************************************
+ * Includes                                       *
+ **************************************************/
+
+#include <stdint.h>
+
+#include "fixedgrid.h"
+#include "params.h"
+
+/**************************************************
+ * Function prototypes                            *
+ **************************************************/
+
+void cfl_init(fixedgrid_t* G);
+
+void cfl_measure(fixedgrid_t* G);
+
+void cfl_update(fixedgrid_t* G);
+
+uint32_t cfl_steps(real_t adv_rate, real_t diff_rate, real_t dt);
+
+uint32_t cfl_substeps(const int n, real_t *wind, real_t *diff,
+                      real_t cell_size, real_t dt);
+
+void print_cfl(fixedgrid_t* G);
+
+#endif
@@ -0,0 +1,212 @@
+#!/bin/bash
+#
+# Generates the night-time ("dark") variants of the KPP ODE function
+# and sparse Jacobian.  When SUN is zero every photolysis rate set in
+# Update_PHOTO is exactly zero, so the reactions they drive contribute
+# nothing.  This script drops those reaction rates (A) and Jacobian
+# partials (B) and every term that uses them, and writes
+#
+#   saprc99_Function_Dark.c  - Fun_Dark
+#   saprc99_Jacobian_Dark.c  - Jac_SP_Dark
+#
+# It also writes the complement of Fun_Dark, which keeps only the
+# photolysis terms.  Fun is linear in the rate constants, so with the
+# time derivatives of the photolysis rates in place of the rates it
+# gives the time derivative of the ODE function:
+#
+#   saprc99_Function_Photo.c - Fun_Photo
+#
+# The sparsity pattern of the Jacobian is unchanged, so the dark
+# Jacobian works with the same LU routines.  Entries that lose all
+# their terms become 0.  Run from the chem directory after
+# regenerating the mechanism with KPP:
+#
+#   cd chem && ./gen_dark.sh
+#
+
+ROOT=${1:-saprc99}
+
+# Reactions whose rate constant is a photolysis rate
+PHOTO=`awk '/^void Update_PHOTO/,/^}/' ${ROOT}_Rates.c | \
+	sed -n 's/^ *RCONST\[\([0-9]*\)\] *=.*/\1/p' | tr '\n' ' '`
+
+if [ -z "$PHOTO" ] ; then
+	echo "No photolysis rates found in ${ROOT}_Rates.c" >&2
+	exit 1
+fi
+
+#
+# darken <input> <function> <output> [Dark|Photo]
+#   Copies the file header and <function> from <input> to <output>,
+#   renaming it <function>_Dark and removing the photolysis terms,
+#   or <function>_Photo and removing all other terms.
+#
+darken()
+{
+	awk -v photo="$PHOTO" -v fname="$2" -v src="$1" -v dst="$3" -v mode="${4:-Dark}" '
+	BEGIN {
+		n = split(photo, p, " ")
+		for(i=1; i<=n; i++) isphoto[p[i]] = 1
+		state = "header"
+	}
+
+	# Pads a comment line to the width of the KPP banners
+	function box(t) {
+		sub(/^\/\* /, "", t) ; sub(/ *\*\/$/, "", t)
+		return length(t) < 65 ? "/* " sprintf("%-65s", t) "*/" : "/* " t " */"
+	}
+
+	# Writes "lhs = rhs;" wrapped like KPP output
+	function emit(lhs, terms, nterms,    line, i, t) {
+		line = "  " lhs " = "
+		if(nterms == 0) { print line "0;" ; return }
+		for(i=1; i<=nterms; i++) {
+			t = terms[i]
+			if(i == 1 && substr(t, 1, 1) == "+") t = substr(t, 2)
+			if(length(line) + length(t) > 70 && i > 1) {
+				print line
+				line = "           "
+			}
+			line = line t
+		}
+		print line ";"
+	}
+
+	# Handles one complete statement
+	function statement(text, raw,    ref, lhs, rhs, sym, idx, t, c, nt, nk, terms, keep, i, m, dropped) {
+		lhs = text ; sub(/ *=.*/, "", lhs) ; sub(/^ */, "", lhs)
+		rhs = text ; sub(/^[^=]*= */, "", rhs) ; sub(/;.*/, "", rhs)
+		gsub(/[ \t\n]/, "", rhs)
+
+		sym = lhs ; sub(/\[.*/, "", sym)
+		idx = lhs ; sub(/^[A-Za-z]*\[/, "", idx) ; sub(/\].*/, "", idx)
+
+		# A rate or partial of a photolysis reaction is zero, as is
+		# a rate computed from such a partial.  For the
+		# photolysis-only function it is the other way round.
+		if(sym == "A" || sym == "B") {
+			t = rhs
+			ref = 0
+			while(match(t, /RCT\[[0-9]+\]|B\[[0-9]+\]/)) {
+				if((substr(t, RSTART, 1) == "R" && (substr(t, RSTART+4, RLENGTH-5) in isphoto)) || \
+				   (substr(t, RSTART, 1) == "B" && (("B", substr(t, RSTART+2, RLENGTH-3)) in dead)))
+					ref = 1
+				t = substr(t, RSTART+RLENGTH)
+			}
+			if(ref == (mode == "Dark")) {
+				dead[sym, idx] = 1
+				pending = ""
+				return
+			}
+			printf "%s%s", pending, raw
+			pending = ""
+			return
+		}
+
+		# Split the sum into signed terms
+		nt = 0 ; t = ""
+		for(i=1; i<=length(rhs); i++) {
+			c = substr(rhs, i, 1)
+			if((c == "+" || c == "-") && t != "") { terms[++nt] = t ; t = "" }
+			t = t c
+		}
+		if(t != "") terms[++nt] = t
+
+		nk = 0 ; dropped = 0
+		for(i=1; i<=nt; i++) {
+			m = terms[i]
+			if(match(m, /[AB]\[[0-9]+\]/) && \
+			   ((substr(m, RSTART, 1), substr(m, RSTART+2, RLENGTH-3)) in dead)) {
+				dropped = 1
+				continue
+			}
+			if(i == 1 && substr(m, 1, 1) != "-") m = "+" m
+			keep[++nk] = m
+		}
+
+		printf "%s", pending
+		pending = ""
+		if(dropped) emit(lhs, keep, nk)
+		else printf "%s", raw
+	}
+
+	# File header, with a note on where this file came from
+	state == "header" {
+		if($0 ~ /^\/\* File  *:/) {
+			print box("File                 : " dst)
+			next
+		}
+		if($0 ~ /^\/\* Output root filename/) {
+			print
+			print "/*                                                                  */"
+			print box("Generated from " src " by gen_dark.sh:")
+			if(mode == "Dark")
+				print box("  photolysis reactions removed for use when SUN == 0")
+			else
+				print box("  only the photolysis reactions, for the time derivative")
+			next
+		}
+		if($0 ~ /^#if DO_CHEMISTRY/) { print ; print "" ; state = "skip" ; next }
+		print
+		next
+	}
+
+	# Find the function and the comment block above it
+	state == "skip" {
+		if($0 ~ "^/\\* " fname " - ") {
+			print "/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */"
+			print "/*                                                                  */"
+			sub("^/\\* " fname " - ", "/* " fname "_" mode " - ")
+			print box($0)
+			state = "proto"
+		}
+		next
+	}
+	state == "proto" {
+		sub("^void " fname "\\(", "void " fname "_" mode "(")
+		print
+		if($0 ~ /^double [AB]\[/) state = "body"
+		next
+	}
+	state == "body" {
+		if($0 ~ /^}/) {
+			printf "%s", pending
+			pending = ""
+			print
+			print ""
+			print box("End of " fname "_" mode " function")
+			print "/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */"
+			print ""
+			print "#endif"
+			state = "done"
+			next
+		}
+		if(stmt != "") {
+			stmt = stmt "\n" $0
+			raw = raw $0 "\n"
+			if($0 ~ /;/) { statement(stmt, raw) ; stmt = "" }
+			next
+		}
+		if($0 ~ /^  [A-Za-z]+\[[0-9]+\] = /) {
+			stmt = $0
+			raw = $0 "\n"
+			if($0 ~ /;/) { statement(stmt, raw) ; stmt = "" }
+			next
+		}
+		# Comments naming a statement go with it
+		if($0 ~ /^\/\* (B|JVS)\([0-9]+\) = /) { printf "%s", pending ; pending = $0 "\n" ; next }
+		printf "%s", pending
+		pending = ""
+		print
+		next
+	}
+	' $1 > $3
+}
+
+darken ${ROOT}_Function.c Fun ${ROOT}_Function_Dark.c
+darken ${ROOT}_Jacobian.c Jac_SP ${ROOT}_Jacobian_Dark.c
+darken ${ROOT}_Function.c Fun ${ROOT}_Function_Photo.c Photo
+
+echo "Removed the terms of `echo $PHOTO | wc -w` photolysis reactions:"
+wc -l ${ROOT}_Function.c ${ROOT}_Function_Dark.c ${ROOT}_Jacobian.c ${ROOT}_Jacobian_Dark.c \
+	${ROOT}_Function_Photo.c | grep -v total
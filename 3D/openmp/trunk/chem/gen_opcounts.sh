@@ -0,0 +1,93 @@
+#!/bin/bash
+#
+# Counts the floating point operations of the unrolled KPP kernels
+# and writes them to saprc99_OpCounts.h for the roofline report:
+#
+#   FUN_FLOPS           - Fun
+#   FUN_DARK_FLOPS      - Fun_Dark
+#   JAC_SP_FLOPS        - Jac_SP
+#   FUN_PHOTO_FLOPS     - Fun_Photo
+#   JAC_SP_DARK_FLOPS   - Jac_SP_Dark
+#   JAC_SP_VEC_FLOPS    - Jac_SP_Vec
+#   KPPSOLVE_FLOPS      - KppSolve
+#
+# Every *, / and binary + or - is one operation ("a -= b" is one);
+# negation and array indexing are not counted.  KppDecomp loops over
+# the sparsity pattern, so its count is taken from LU_CROW and LU_DIAG
+# at run time instead.  Run from the chem directory after
+# regenerating the kernels ("make kernels"):
+#
+#   cd chem && ./gen_opcounts.sh
+#
+
+ROOT=${1:-saprc99}
+DST=${ROOT}_OpCounts.h
+
+#
+# count <file> <function>
+#
+function count {
+	awk -v f="$2" '
+		$0 ~ "^void " f "\\(" { body = 0 ; found = 1 ; next }
+		found && /^\{/        { body = 1 ; next }
+		found && body && /^\}/ { exit }
+		found && body         { printf("%s", $0) }
+	' $1 | awk '{
+		s = $0
+		gsub(/\/\*[^*]*\*\//, "", s)          # comments
+		gsub(/^ *double [^;]*;/, "", s)        # declarations
+		gsub(/\[[^]]*\]/, "", s)               # indices
+		gsub(/[0-9.]+[eE][-+]?[0-9]+/, "N", s) # exponents
+		gsub(/[ \t]/, "", s)
+		n = 0 ; prev = ""
+		for(i = 1; i <= length(s); i++) {
+			c = substr(s, i, 1)
+			if(c == "*" || c == "/")
+				++n
+			else if((c == "+" || c == "-") && prev ~ /[A-Za-z0-9_)]/)
+				++n
+			prev = c
+		}
+		print n
+	}'
+}
+
+FUN=`count ${ROOT}_Function.c Fun`
+FUN_DARK=`count ${ROOT}_Function_Dark.c Fun_Dark`
+FUN_PHOTO=`count ${ROOT}_Function_Photo.c Fun_Photo`
+JAC=`count ${ROOT}_Jacobian.c Jac_SP`
+JAC_DARK=`count ${ROOT}_Jacobian_Dark.c Jac_SP_Dark`
+JAC_VEC=`count ${ROOT}_Jacobian.c Jac_SP_Vec`
+SOLVE=`count ${ROOT}_LinearAlgebra.c KppSolve`
+
+for n in "$FUN" "$FUN_DARK" "$FUN_PHOTO" "$JAC" "$JAC_DARK" "$JAC_VEC" "$SOLVE" ; do
+	if [ -z "$n" ] || [ "$n" -eq 0 ] ; then
+		echo "Couldn't count the operations of a kernel" >&2
+		exit 1
+	fi
+done
+
+cat > $DST <<EOF
+/*
+ *  ${DST}
+ *
+ *  Floating point operations per call of the unrolled kernels.
+ *  Generated by gen_opcounts.sh; do not edit.
+ *
+ */
+
+#ifndef __SAPRC99_OPCOUNTS_H__
+#define __SAPRC99_OPCOUNTS_H__
+
+#define FUN_FLOPS          $FUN
+#define FUN_DARK_FLOPS     $FUN_DARK
+#define FUN_PHOTO_FLOPS    $FUN_PHOTO
+#define JAC_SP_FLOPS       $JAC
+#define JAC_SP_DARK_FLOPS  $JAC_DARK
+#define JAC_SP_VEC_FLOPS   $JAC_VEC
+#define KPPSOLVE_FLOPS     $SOLVE
+
+#endif
+EOF
+
+echo "Wrote $DST: Fun $FUN, Fun_Dark $FUN_DARK, Fun_Photo $FUN_PHOTO, Jac_SP $JAC, Jac_SP_Dark $JAC_DARK, Jac_SP_Vec $JAC_VEC, KppSolve $SOLVE"
@@ -0,0 +1,177 @@
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/* The ODE Function of Chemical Model File                          */
+/*                                                                  */
+/* Generated by KPP-2.2 symbolic chemistry Kinetics PreProcessor    */
+/*       (http://www.cs.vt.edu/~asandu/Software/KPP)                */
+/* KPP is distributed under GPL, the general public licence         */
+/*       (http://www.gnu.org/copyleft/gpl.html)                     */
+/* (C) 1995-1997, V. Damian & A. Sandu, CGRER, Univ. Iowa           */
+/* (C) 1997-2005, A. Sandu, Michigan Tech, Virginia Tech            */
+/*     With important contributions from:                           */
+/*        M. Damian, Villanova University, USA                      */
+/*        R. Sander, Max-Planck Institute for Chemistry, Mainz, Germany */
+/*                                                                  */
+/* File                 : saprc99_Function_Photo.c                  */
+/* Time                 : Wed Jan  2 14:34:04 2008                  */
+/* Working directory    : /home/jlinford/workspace/fixedgrid/serial/chem */
+/* Equation file        : saprc99.kpp                               */
+/* Output root filename : saprc99                                   */
+/*                                                                  */
+/* Generated from saprc99_Function.c by gen_dark.sh:                */
+/*   only the photolysis reactions, for the time derivative         */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include "saprc99_Parameters.h"
+#include "saprc99_Global.h"
+#include "saprc99_Sparse.h"
+
+#if DO_CHEMISTRY == 1
+
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/* Fun_Photo - time derivatives of variables - Agregate form        */
+/*   Arguments :                                                    */
+/*      V         - Concentrations of variable species (local)      */
+/*      F         - Concentrations of fixed species (local)         */
+/*      RCT       - Rate constants (local)                          */
+/*      Vdot      - Time derivative of variable species concentrations */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+void Fun_Photo( 
+  double V[],                            /* Concentrations of variable species (local) */
+  double F[],                            /* Concentrations of fixed species (local) */
+  double RCT[],                          /* Rate constants (local) */
+  double Vdot[]                          /* Time derivative of variable species concentrations */
+)
+{
+
+/* Local variables                                                  */
+double A[NREACT];                        /* Rate for each equation */
+
+/* Computation of equation rates                                    */
+  A[0] = RCT[0]*V[69];
+  A[14] = RCT[14]*V[70];
+  A[15] = RCT[15]*V[70];
+  A[16] = RCT[16]*V[61];
+  A[17] = RCT[17]*V[61];
+  A[21] = RCT[21]*V[18];
+  A[22] = RCT[22]*V[18];
+  A[27] = RCT[27]*V[42];
+  A[33] = RCT[33]*V[24];
+  A[40] = RCT[40]*V[16];
+  A[122] = RCT[122]*V[55];
+  A[123] = RCT[123]*V[55];
+  A[130] = RCT[130]*V[54];
+  A[133] = RCT[133]*V[58];
+  A[136] = RCT[136]*V[41];
+  A[138] = RCT[138]*V[59];
+  A[141] = RCT[141]*V[25];
+  A[143] = RCT[143]*V[36];
+  A[144] = RCT[144]*V[44];
+  A[145] = RCT[145]*V[44];
+  A[148] = RCT[148]*V[40];
+  A[151] = RCT[151]*V[11];
+  A[158] = RCT[158]*V[37];
+  A[164] = RCT[164]*V[49];
+  A[168] = RCT[168]*V[53];
+  A[172] = RCT[172]*V[51];
+  A[174] = RCT[174]*V[60];
+  A[176] = RCT[176]*V[56];
+  A[180] = RCT[180]*V[31];
+  A[182] = RCT[182]*V[32];
+
+/* Aggregate function                                               */
+  Vdot[0] = 0;
+  Vdot[1] = 0;
+  Vdot[2] = 0;
+  Vdot[3] = 0;
+  Vdot[4] = 0;
+  Vdot[5] = 0;
+  Vdot[6] = 0;
+  Vdot[7] = 7*A[158];
+  Vdot[8] = 0;
+  Vdot[9] = A[17];
+  Vdot[10] = 0;
+  Vdot[11] = -A[151];
+  Vdot[12] = 0;
+  Vdot[13] = 0;
+  Vdot[14] = 0;
+  Vdot[15] = 0;
+  Vdot[16] = -A[40];
+  Vdot[17] = 0;
+  Vdot[18] = -A[21]-A[22];
+  Vdot[19] = 0;
+  Vdot[20] = 0;
+  Vdot[21] = 0;
+  Vdot[22] = 0;
+  Vdot[23] = 0;
+  Vdot[24] = -A[33];
+  Vdot[25] = -A[141];
+  Vdot[26] = 0;
+  Vdot[27] = 0;
+  Vdot[28] = 0;
+  Vdot[29] = 0;
+  Vdot[30] = 0;
+  Vdot[31] = -A[180];
+  Vdot[32] = -A[182];
+  Vdot[33] = 0;
+  Vdot[34] = 0;
+  Vdot[35] = 0;
+  Vdot[36] = -A[143];
+  Vdot[37] = -A[158];
+  Vdot[38] = 0;
+  Vdot[39] = A[122]+A[123]+A[130]+A[133]+2*A[144]+A[145]+A[148]
+           +0.67*A[164]+0.7*A[168]+1.233*A[172]+A[180]+A[182];
+  Vdot[40] = -A[148]+0.5*A[180]+0.5*A[182];
+  Vdot[41] = -A[136]+0.02*A[176];
+  Vdot[42] = -A[27];
+  Vdot[43] = 0;
+  Vdot[44] = -A[144]-A[145]+0.5*A[180]+0.5*A[182];
+  Vdot[45] = 0;
+  Vdot[46] = 0;
+  Vdot[47] = 0.515*A[174]+0.152*A[176]+A[180]+A[182];
+  Vdot[48] = 0;
+  Vdot[49] = -A[164];
+  Vdot[50] = 0;
+  Vdot[51] = -A[172];
+  Vdot[52] = 0;
+  Vdot[53] = -A[168];
+  Vdot[54] = -A[130]+A[133]+A[138]+0.467*A[172]+0.246*A[174]
+           +0.431*A[176];
+  Vdot[55] = -A[122]-A[123]+A[141]+A[145]+0.67*A[164]+0.3*A[172]
+           +0.506*A[174]+0.134*A[176];
+  Vdot[56] = -A[176];
+  Vdot[57] = A[0]+A[15]+A[16];
+  Vdot[58] = -A[133]+A[143]+0.71*A[174]+0.147*A[176];
+  Vdot[59] = -A[138]+0.233*A[172]+0.243*A[176];
+  Vdot[60] = 0.7*A[168]-A[174]+0.435*A[176];
+  Vdot[61] = -A[16]-A[17];
+  Vdot[62] = A[22]+0.61*A[33]+2*A[122]+A[130]+A[133]+A[141]+A[143]
+           +2*A[144]+A[148]+0.34*A[164]+1.233*A[172]+0.341*A[176]
+           +0.5*A[180]+0.5*A[182];
+  Vdot[63] = 0.04*A[174]+0.095*A[176];
+  Vdot[64] = 0.33*A[164]+0.3*A[168];
+  Vdot[65] = A[130]+A[136]+0.3*A[168];
+  Vdot[66] = 0;
+  Vdot[67] = A[133]+A[138]+0.33*A[164]+0.96*A[174]+0.564*A[176]+A[180]
+           +A[182];
+  Vdot[68] = A[0]+A[14]+A[21];
+  Vdot[69] = -A[0]+A[15]+A[22]+A[27]+0.61*A[33]+A[176];
+  Vdot[70] = -A[14]-A[15]+0.39*A[33];
+  Vdot[71] = A[136]+A[138]+A[148]+2*A[151]+0.67*A[164]+0.467*A[172]
+           +0.667*A[174]+0.5*A[180]+0.5*A[182];
+  Vdot[72] = 0.3*A[172]+0.333*A[174];
+  Vdot[73] = A[21]+A[27]+0.39*A[33]+2*A[40]+A[141]+A[143]+0.33*A[164];
+}
+
+/* End of Fun_Photo function                                        */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#endif
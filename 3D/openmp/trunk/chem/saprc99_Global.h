@@ -41,4 +41,7 @@ extern double ATOL[NVAR];                       /* Absolute tolerance */
 extern double RTOL[NVAR];                       /* Relative tolerance */
 extern double STEPMIN;                          /* Lower bound for integration step */
 
+/* Each thread integrates its own cells */
+#pragma omp threadprivate(C, VAR, FIX, RCONST, TIME, SUN, TEMP, DT)
+
 #endif
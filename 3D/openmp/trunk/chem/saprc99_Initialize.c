@@ -36,13 +36,13 @@
 /*                                                                  */
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
-void saprc99_Initialize(real_t C[NSPEC])
+void saprc99_Initialize(double C[NSPEC])
 {
     int i;
-    real_t x;
+    double x;
     
-    real_t * VAR = &C[0];
-    real_t * FIX = &C[74];
+    double * VAR = &C[0];
+    double * FIX = &C[NFIXST];
     
     /* Initialize concentrations */
     x = (0.0e0)*CFACTOR;
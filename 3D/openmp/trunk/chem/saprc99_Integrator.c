@@ -53,12 +53,14 @@
 #define  DeltaMin (double)1.0e-6    
 
 /*~~~> Collect statistics: global variables */   
-int Nfun,Njac,Nstp,Nacc,Nrej,Ndec,Nsol,Nsng;
+int Nfun,Njac,Nstp,Nacc,Nrej,Ndec,Nsol,Nsng,Nfdk,Njdk,Npht;
+#pragma omp threadprivate(Nfun,Njac,Nstp,Nacc,Nrej,Ndec,Nsol,Nsng,Nfdk,Njdk,Npht)
 
 
 /*~~~> Function headers */   
 void FunTemplate(double,  double [], double []); 
 void JacTemplate(double,  double [], double []) ;
+void FunJacTemplate(double,  double [], double [], double []) ;
 int Rosenbrock( double Y[], double Tstart, double Tend,
                 double AbsTol[],  double RelTol[],
                double RPAR[], int IPAR[]);
@@ -70,7 +72,8 @@ int RosenbrockIntegrator(
                          double ros_A[], double ros_C[],
                          double ros_Alpha[],double  ros_Gamma[],
                          double ros_ELO, char ros_NewF[],
-                         char Autonomous, char VectorTol, int Max_no_steps,  
+                         char Autonomous, char VectorTol, char MixedLU,
+                         int Max_no_steps,  
                          double Roundoff, double Hmin, double Hmax, double Hstart,
                          double FacMin, double FacMax, double FacRej, double FacSafe, 
                          double *Texit, double *Hexit ); 
@@ -78,6 +81,11 @@ char ros_PrepareMatrix (
                         double* H, 
                         int Direction,  double gam, double Jac0[], 
                         double Ghimj[], int Pivot[] );
+char ros_PrepareMatrixSP (
+                          double* H, 
+                          int Direction,  double gam, double Jac0[], 
+                          float GhimjSP[] );
+void ros_SolveRefine ( double ghinv, double Jac0[], float GhimjSP[], double b[] );
 double ros_ErrorNorm ( 
                        double Y[], double Ynew[], double Yerr[], 
                        double AbsTol[],  double RelTol[], 
@@ -87,8 +95,13 @@ void ros_FunTimeDerivative (
                             double T, double Roundoff, 
                              double Y[], double Fcn0[], 
                             double dFdT[] );
+char ros_PhotoTimeDerivative ( double T, double Y[], double dFdT[] );
 void Fun(  double Y[],  double FIX[],  double RCONST[], double Ydot[] );
 void Jac_SP(  double Y[],  double FIX[],  double RCONST[], double Ydot[] );
+void Fun_Dark(  double Y[],  double FIX[],  double RCONST[], double Ydot[] );
+void Fun_Photo(  double Y[],  double FIX[],  double RCONST[], double Ydot[] );
+void Jac_SP_Dark(  double Y[],  double FIX[],  double RCONST[], double Ydot[] );
+void Jac_SP_Vec( double JVS[], double UV[], double JUV[] );
 void FunTemplate( double T,  double Y[], double Ydot[] );
 void JacTemplate( double T,  double Y[], double Ydot[] );
 void DecompTemplate( double A[], int Pivot[], int* ising );
@@ -119,8 +132,12 @@ void Rodas4 ( int *ros_S, double ros_A[], double ros_C[],
              char ros_NewF[], double *ros_ELO, char* ros_Name );
 int  KppDecomp( double A[] );
 void KppSolve ( double A[], double b[] );
+int  KppDecompSP( float A[] );
+void KppSolveSP ( float A[], float b[] );
 void Update_SUN();
 void Update_RCONST();
+void Update_PHOTO();
+double SUN_Rate();
 
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -206,6 +223,11 @@ int Rosenbrock( double Y[], double Tstart, double Tend,
  = 4 :  method is  Rodas3
  = 5:   method is  Rodas4
  
+ IPAR[4]   = 0: stage systems are factored and solved in double precision
+ = 1: stage matrix and its LU are kept in single precision; each
+ solve is followed by one step of iterative refinement with
+ the residual computed in double precision from Jac0
+ 
  RPAR[0]  -> Hmin, lower bound for the integration step size
  It is strongly recommended to keep Hmin = ZERO 
  RPAR[1]  -> Hmax, upper bound for the integration step size
@@ -223,7 +245,7 @@ int Rosenbrock( double Y[], double Tstart, double Tend,
  
  Note: each call to Rosenbrock adds the corrent no. of fcn calls
  to previous value of IPAR[10], and similar for the other params.
- Set IPAR(11:20) = 0 before call to avoid this accumulation.
+ Set IPAR(11:21) = 0 before call to avoid this accumulation.
  
  IPAR[10] = No. of function calls
  IPAR[11] = No. of jacobian calls
@@ -233,6 +255,9 @@ int Rosenbrock( double Y[], double Tstart, double Tend,
  IPAR[15] = No. of LU decompositions
  IPAR[16] = No. of forward/backward substitutions
  IPAR[17] = No. of singular matrix decompositions
+ IPAR[18] = No. of function calls made with the dark kernel (Fun_Dark)
+ IPAR[19] = No. of jacobian calls made with the dark kernel (Jac_SP_Dark)
+ IPAR[20] = No. of photolysis derivative calls (Fun_Photo)
  
  RPAR[10]  -> Texit, the time corresponding to the 
  computed Y upon return
@@ -250,7 +275,7 @@ int Rosenbrock( double Y[], double Tstart, double Tend,
     char ros_NewF[Smax], ros_Name[12];
     /*~~~>  Local variables    */  
     int Max_no_steps, IERR, i, UplimTol;
-    char Autonomous, VectorTol;
+    char Autonomous, VectorTol, MixedLU;
     double Roundoff,FacMin,FacMax,FacRej,FacSafe;
     double Hmin, Hmax, Hstart, Hexit, Texit;
     /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
@@ -264,10 +289,16 @@ int Rosenbrock( double Y[], double Tstart, double Tend,
     Ndec = IPAR[15];
     Nsol = IPAR[16];
     Nsng = IPAR[17];
+    Nfdk = IPAR[18];
+    Njdk = IPAR[19];
+    Npht = IPAR[20];
     
     /*~~~>  Autonomous or time dependent ODE. Default is time dependent. */
     Autonomous = !(IPAR[0] == 0);
     
+    /*~~~>  Single precision LU with iterative refinement. Default is double. */
+    MixedLU = !(IPAR[4] == 0);
+    
     /*~~~>  For Scalar tolerances (IPAR[1] != 0)  the code uses AbsTol[0] and RelTol[0]
      !   For Vector tolerances (IPAR[1] == 0) the code uses AbsTol(1:NVAR) and RelTol(1:NVAR) */
     if (IPAR[1] == 0) {
@@ -403,7 +434,7 @@ int Rosenbrock( double Y[], double Tstart, double Tend,
                                 ros_S, ros_M, ros_E, ros_A, ros_C, 
                                 ros_Alpha, ros_Gamma, ros_ELO, ros_NewF,
                                 /*  Integration parameters */ 
-                                Autonomous, VectorTol, Max_no_steps,
+                                Autonomous, VectorTol, MixedLU, Max_no_steps,
                                 Roundoff, Hmin, Hmax, Hstart,
                                 FacMin, FacMax, FacRej, FacSafe, 
                                 /* Output parameters */ 
@@ -418,6 +449,9 @@ int Rosenbrock( double Y[], double Tstart, double Tend,
     IPAR[15] = Ndec;
     IPAR[16] = Nsol;
     IPAR[17] = Nsng;
+    IPAR[18] = Nfdk;
+    IPAR[19] = Njdk;
+    IPAR[20] = Npht;
     /*~~~> Last T and H */
     RPAR[10] = Texit;
     RPAR[11] = Hexit;
@@ -442,7 +476,7 @@ int RosenbrockIntegrator(
                          double ros_Alpha[],double  ros_Gamma[],
                          double ros_ELO, char ros_NewF[],
                          /*~~~> Input: integration parameters  */     
-                         char Autonomous, char VectorTol,
+                         char Autonomous, char VectorTol, char MixedLU,
                          int Max_no_steps,  
                          double Roundoff, double Hmin, double Hmax, double Hstart,
                          double FacMin, double FacMax, double FacRej, double FacSafe, 
@@ -460,11 +494,12 @@ int RosenbrockIntegrator(
     double Ynew[74], Fcn0[74], Fcn[74],
     dFdT[74],
     Jac0[920], Ghimj[920];
+    float GhimjSP[920];
     double K[74*ros_S];   
-    double H, T, Hnew, HC, HG, Fac, Tau; 
+    double H, T, Hnew, HC, HG, Fac, Tau, ghinv = ZERO; 
     double Err, Yerr[74];
     int Pivot[74], Direction, ioffset, j, istage;
-    char RejectLastH, RejectMoreH;
+    char RejectLastH, RejectMoreH, TimeDep;
     
     /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
     
@@ -500,25 +535,44 @@ int RosenbrockIntegrator(
         *Hexit = H;
         H = MIN(H,ABS(Tend-T));
         
+#if CHEM_FUSED_FUNJAC == 1
+        /*~~~>   Compute the function and Jacobian at current time  */
+        FunJacTemplate(T,Y,Fcn0,Jac0);
+#else
         /*~~~>   Compute the function at current time  */
         FunTemplate(T,Y,Fcn0);
         
+        /*~~~>   Compute the Jacobian at current time  */
+        JacTemplate(T,Y,Jac0);
+#endif
+        
         /*~~~>  Compute the function derivative with respect to T  */
-        if (!Autonomous) {
+        TimeDep = !Autonomous;
+        if (TimeDep) {
+#if CHEM_ANALYTIC_DFDT == 1
+            TimeDep = ros_PhotoTimeDerivative ( T, Y, dFdT );
+#else
             ros_FunTimeDerivative ( T, Roundoff, Y, Fcn0, dFdT );
+#endif
         }
         
-        /*~~~>   Compute the Jacobian at current time  */
-        JacTemplate(T,Y,Jac0);
-        
         /*~~~>  Repeat step calculation until current step accepted  */
         while (1) { /* WHILE STEP NOT ACCEPTED */
             
             
-            if( ros_PrepareMatrix( &H, Direction, ros_Gamma[0],
-                                  Jac0, Ghimj, Pivot) ) { /* More than 5 consecutive failed decompositions */
-                *Texit = T;
-                return ros_ErrorMsg(-8,T,H);
+            if( MixedLU ) {
+                if( ros_PrepareMatrixSP( &H, Direction, ros_Gamma[0],
+                                        Jac0, GhimjSP) ) { /* More than 5 consecutive failed decompositions */
+                    *Texit = T;
+                    return ros_ErrorMsg(-8,T,H);
+                }
+                ghinv = ONE/(Direction*H*ros_Gamma[0]);
+            } else {
+                if( ros_PrepareMatrix( &H, Direction, ros_Gamma[0],
+                                      Jac0, Ghimj, Pivot) ) { /* More than 5 consecutive failed decompositions */
+                    *Texit = T;
+                    return ros_ErrorMsg(-8,T,H);
+                }
             }
             /*~~~>   Compute the stages  */
             for (istage = 1; istage <= ros_S; istage++) 
@@ -552,13 +606,16 @@ int RosenbrockIntegrator(
                     WAXPY(74,HC,&K[74*(j-1)],1,&K[ioffset],1);
                 } /* for j */
                 
-                if ((!Autonomous) && (ros_Gamma[istage-1])) 
+                if ((TimeDep) && (ros_Gamma[istage-1])) 
                 { 
                     HG = Direction*H*ros_Gamma[istage-1];
                     WAXPY(74,HG,dFdT,1,&K[ioffset],1);
-                } /* end if !Autonomous */
+                } /* end if TimeDep */
                 
-                SolveTemplate(Ghimj, Pivot, &K[ioffset]);
+                if( MixedLU )
+                    ros_SolveRefine(ghinv, Jac0, GhimjSP, &K[ioffset]);
+                else
+                    SolveTemplate(Ghimj, Pivot, &K[ioffset]);
                 
             } /* for istage */	    
             
@@ -666,6 +723,45 @@ void ros_FunTimeDerivative (
 }  /*  ros_FunTimeDerivative */
 
 
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+char ros_PhotoTimeDerivative ( 
+                              /*~~~> Input arguments: */ 
+                              double T, double Y[], 
+                              /*~~~> Output arguments: */ 
+                              double dFdT[] )
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ The time partial derivative of the function, analytically.
+ Only the photolysis rates depend on T (through SUN) and the function
+ is linear in the rate constants, so dF/dT is the photolysis part of
+ the function (Fun_Photo) with each rate replaced by its derivative.
+ Returns 0, leaving dFdT unset, if SUN is constant at T (night):
+ the step is then autonomous.
+ ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
+{
+    /*~~~> Local variables */     
+    double Told, Sold, dSun;    
+    
+    Told = TIME;
+    TIME = T;
+    dSun = SUN_Rate();
+    TIME = Told;
+    if (dSun == ZERO) return 0;
+    
+    /*~~~> Photolysis rates are proportional to SUN */
+    Sold = SUN;
+    SUN = dSun;
+    Update_PHOTO();
+    Fun_Photo( Y, FIX, RCONST, dFdT );
+    SUN = Sold;
+    Update_PHOTO();
+    
+    Npht++;
+    
+    return 1;
+    
+}  /*  ros_PhotoTimeDerivative */
+
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
 char ros_PrepareMatrix (
                         /* Inout argument: (step size is decreased when LU fails) */  
@@ -722,6 +818,98 @@ char ros_PrepareMatrix (
 }  /*  ros_PrepareMatrix */
 
 
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
+char ros_PrepareMatrixSP (
+                          /* Inout argument: (step size is decreased when LU fails) */  
+                          double* H, 
+                          /* Input arguments: */    
+                          int Direction,  double gam, double Jac0[], 
+                          /* Output arguments: */	  
+                          float GhimjSP[] )
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ Single precision version of ros_PrepareMatrix.
+ Ghimj = 1/(H*ham) - Jac0 is formed in double precision, rounded
+ to single precision and factored in single precision.
+ 
+ Return value:       Singular (true=1=failed_LU or false=0=successful_LU)
+ ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
+{   
+    /*~~~> Local variables */     
+    int i, ising, Nconsecutive;
+    double ghinv;
+    
+    Nconsecutive = 0;    
+    
+    while (1) {  /* while Singular */
+        
+        /*~~~>    Construct Ghimj = 1/(H*ham) - Jac0 */
+        for (i=0; i<920; i++) {
+            GhimjSP[i] = (float)(-Jac0[i]);
+        } /* for i */
+        ghinv = ONE/(Direction*(*H)*gam);
+        for (i=0; i<74; i++) {
+            GhimjSP[LU_DIAG[i]] = (float)(ghinv-Jac0[LU_DIAG[i]]);
+        } /* for i */
+        
+        /*~~~>    Compute LU decomposition  */
+        ising = KppDecompSP( GhimjSP );
+        Ndec++;
+        if (ising == 0) {
+            /*~~~>    if successful done  */
+            return 0;  /* Singular = false */
+        } else { /* ising .ne. 0 */
+            /*~~~>    if unsuccessful half the step size; if 5 consecutive fails return */
+            Nsng++; Nconsecutive++;
+            printf("\nWarning: LU Decomposition returned ising = %d\n",ising);
+            if (Nconsecutive <= 5) { /* Less than 5 consecutive failed LUs */
+                *H = (*H)*HALF;
+            } else {                  /* More than 5 consecutive failed LUs */
+                return 1; /* Singular = true */
+            } /* end if  Nconsecutive */
+        } /* end if ising */
+        
+    } /* while Singular */
+    
+}  /*  ros_PrepareMatrixSP */
+
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
+void ros_SolveRefine ( double ghinv, double Jac0[], float GhimjSP[], double b[] )
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ Solves (ghinv*I - Jac0) x = b with the single precision LU in GhimjSP,
+ then applies one step of iterative refinement:
+   r = b - (ghinv*I - Jac0) x    (double precision)
+   x = x + LU \ r
+ On return b holds x.
+ ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
+{
+    /*~~~> Local variables */     
+    float xs[74];
+    double x[74], Jx[74];
+    int i;
+    
+    /*~~~>    First solve */
+    for (i=0; i<74; i++)
+        xs[i] = (float)b[i];
+    KppSolveSP( GhimjSP, xs );
+    for (i=0; i<74; i++)
+        x[i] = xs[i];
+    
+    /*~~~>    Residual against the double precision matrix */
+    Jac_SP_Vec( Jac0, x, Jx );
+    for (i=0; i<74; i++)
+        xs[i] = (float)(b[i] - ghinv*x[i] + Jx[i]);
+    
+    /*~~~>    Correction */
+    KppSolveSP( GhimjSP, xs );
+    for (i=0; i<74; i++)
+        b[i] = x[i] + xs[i];
+    
+    Nsol += 2;
+    
+}  /*  ros_SolveRefine */
+
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
 int ros_ErrorMsg(int Code, double T, double H)
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -1178,6 +1366,15 @@ void FunTemplate( double T,  double Y[], double Ydot[] )
     TIME = T;
     Update_SUN();
     Update_RCONST();
+#if CHEM_DARK_KERNELS == 1
+    /* No photolysis at night */
+    if(SUN == 0.0)
+    {
+        Fun_Dark( Y, FIX, RCONST, Ydot );
+        Nfdk++;
+    }
+    else
+#endif
     Fun( Y, FIX, RCONST, Ydot );
     TIME = Told;
     
@@ -1200,6 +1397,14 @@ void JacTemplate( double T,  double Y[], double Jcb[] )
     TIME = T ; 
     Update_SUN();
     Update_RCONST();
+#if CHEM_DARK_KERNELS == 1
+    if(SUN == 0.0)
+    {
+        Jac_SP_Dark( Y, FIX, RCONST, Jcb );
+        Njdk++;
+    }
+    else
+#endif
     Jac_SP( Y, FIX, RCONST, Jcb );
     TIME = Told;
     
@@ -1208,6 +1413,42 @@ void JacTemplate( double T,  double Y[], double Jcb[] )
 } /* JacTemplate   */                                    
 
 
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
+void FunJacTemplate( double T,  double Y[], double Ydot[], double Jcb[] )
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~   
+ The ODE function and Jacobian at the same point, sharing one update
+ of the sunlight and rate coefficients
+ ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
+{
+    /*~~~> Local variables */
+    double Told;     
+    
+    Told = TIME;
+    TIME = T ; 
+    Update_SUN();
+    Update_RCONST();
+#if CHEM_DARK_KERNELS == 1
+    if(SUN == 0.0)
+    {
+        Fun_Dark( Y, FIX, RCONST, Ydot );
+        Jac_SP_Dark( Y, FIX, RCONST, Jcb );
+        Nfdk++;
+        Njdk++;
+    }
+    else
+#endif
+    {
+        Fun( Y, FIX, RCONST, Ydot );
+        Jac_SP( Y, FIX, RCONST, Jcb );
+    }
+    TIME = Told;
+    
+    Nfun++;
+    Njac++;
+    
+} /* FunJacTemplate   */                                    
+
+
 /* End of INTEGRATE function                                        */
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
@@ -0,0 +1,2636 @@
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/* The ODE Jacobian of Chemical Model File                          */
+/*                                                                  */
+/* Generated by KPP-2.2 symbolic chemistry Kinetics PreProcessor    */
+/*       (http://www.cs.vt.edu/~asandu/Software/KPP)                */
+/* KPP is distributed under GPL, the general public licence         */
+/*       (http://www.gnu.org/copyleft/gpl.html)                     */
+/* (C) 1995-1997, V. Damian & A. Sandu, CGRER, Univ. Iowa           */
+/* (C) 1997-2005, A. Sandu, Michigan Tech, Virginia Tech            */
+/*     With important contributions from:                           */
+/*        M. Damian, Villanova University, USA                      */
+/*        R. Sander, Max-Planck Institute for Chemistry, Mainz, Germany */
+/*                                                                  */
+/* File                 : saprc99_Jacobian_Dark.c                   */
+/* Time                 : Wed Jan  2 14:34:04 2008                  */
+/* Working directory    : /home/jlinford/workspace/fixedgrid/serial/chem */
+/* Equation file        : saprc99.kpp                               */
+/* Output root filename : saprc99                                   */
+/*                                                                  */
+/* Generated from saprc99_Jacobian.c by gen_dark.sh:                */
+/*   photolysis reactions removed for use when SUN == 0             */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include "saprc99_Parameters.h"
+#include "saprc99_Global.h"
+#include "saprc99_Sparse.h"
+
+#if DO_CHEMISTRY == 1
+
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/* Jac_SP_Dark - the Jacobian of Variables in sparse matrix representation */
+/*   Arguments :                                                    */
+/*      V         - Concentrations of variable species (local)      */
+/*      F         - Concentrations of fixed species (local)         */
+/*      RCT       - Rate constants (local)                          */
+/*      JVS       - sparse Jacobian of variables                    */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+void Jac_SP_Dark( 
+  double V[],                            /* Concentrations of variable species (local) */
+  double F[],                            /* Concentrations of fixed species (local) */
+  double RCT[],                          /* Rate constants (local) */
+  double JVS[]                           /* sparse Jacobian of variables */
+)
+{
+
+/* Local variables                                                  */
+double B[373];                           /* Temporary array */
+
+/* B(1) = dA(1)/dV(57)                                              */
+  B[1] = RCT[1]*F[0]*F[1];
+/* B(4) = dA(2)/dV(57)                                              */
+  B[4] = RCT[2]*V[61];
+/* B(5) = dA(2)/dV(61)                                              */
+  B[5] = RCT[2]*V[57];
+/* B(6) = dA(3)/dV(57)                                              */
+  B[6] = RCT[3]*V[68]*F[0];
+/* B(7) = dA(3)/dV(68)                                              */
+  B[7] = RCT[3]*V[57]*F[0];
+/* B(9) = dA(4)/dV(57)                                              */
+  B[9] = RCT[4]*V[69];
+/* B(10) = dA(4)/dV(69)                                             */
+  B[10] = RCT[4]*V[57];
+/* B(11) = dA(5)/dV(57)                                             */
+  B[11] = RCT[5]*V[69];
+/* B(12) = dA(5)/dV(69)                                             */
+  B[12] = RCT[5]*V[57];
+/* B(13) = dA(6)/dV(61)                                             */
+  B[13] = RCT[6]*V[68];
+/* B(14) = dA(6)/dV(68)                                             */
+  B[14] = RCT[6]*V[61];
+/* B(15) = dA(7)/dV(61)                                             */
+  B[15] = RCT[7]*V[69];
+/* B(16) = dA(7)/dV(69)                                             */
+  B[16] = RCT[7]*V[61];
+/* B(17) = dA(8)/dV(68)                                             */
+  B[17] = RCT[8]*V[70];
+/* B(18) = dA(8)/dV(70)                                             */
+  B[18] = RCT[8]*V[68];
+/* B(19) = dA(9)/dV(68)                                             */
+  B[19] = RCT[9]*2*V[68]*F[1];
+/* B(21) = dA(10)/dV(69)                                            */
+  B[21] = RCT[10]*V[70];
+/* B(22) = dA(10)/dV(70)                                            */
+  B[22] = RCT[10]*V[69];
+/* B(23) = dA(11)/dV(17)                                            */
+  B[23] = RCT[11];
+/* B(24) = dA(12)/dV(17)                                            */
+  B[24] = RCT[12]*F[2];
+/* B(26) = dA(13)/dV(69)                                            */
+  B[26] = RCT[13]*V[70];
+/* B(27) = dA(13)/dV(70)                                            */
+  B[27] = RCT[13]*V[69];
+/* B(32) = dA(18)/dV(9)                                             */
+  B[32] = RCT[18]*F[2];
+/* B(34) = dA(19)/dV(9)                                             */
+  B[34] = RCT[19]*F[0];
+/* B(36) = dA(20)/dV(68)                                            */
+  B[36] = RCT[20]*V[73];
+/* B(37) = dA(20)/dV(73)                                            */
+  B[37] = RCT[20]*V[68];
+/* B(40) = dA(23)/dV(18)                                            */
+  B[40] = RCT[23]*V[73];
+/* B(41) = dA(23)/dV(73)                                            */
+  B[41] = RCT[23]*V[18];
+/* B(42) = dA(24)/dV(69)                                            */
+  B[42] = RCT[24]*V[73];
+/* B(43) = dA(24)/dV(73)                                            */
+  B[43] = RCT[24]*V[69];
+/* B(44) = dA(25)/dV(70)                                            */
+  B[44] = RCT[25]*V[73];
+/* B(45) = dA(25)/dV(73)                                            */
+  B[45] = RCT[25]*V[70];
+/* B(46) = dA(26)/dV(42)                                            */
+  B[46] = RCT[26]*V[73];
+/* B(47) = dA(26)/dV(73)                                            */
+  B[47] = RCT[26]*V[42];
+/* B(49) = dA(28)/dV(39)                                            */
+  B[49] = RCT[28]*V[73];
+/* B(50) = dA(28)/dV(73)                                            */
+  B[50] = RCT[28]*V[39];
+/* B(51) = dA(29)/dV(61)                                            */
+  B[51] = RCT[29]*V[73];
+/* B(52) = dA(29)/dV(73)                                            */
+  B[52] = RCT[29]*V[61];
+/* B(53) = dA(30)/dV(62)                                            */
+  B[53] = RCT[30]*V[68];
+/* B(54) = dA(30)/dV(68)                                            */
+  B[54] = RCT[30]*V[62];
+/* B(55) = dA(31)/dV(62)                                            */
+  B[55] = RCT[31]*V[69];
+/* B(56) = dA(31)/dV(69)                                            */
+  B[56] = RCT[31]*V[62];
+/* B(57) = dA(32)/dV(24)                                            */
+  B[57] = RCT[32];
+/* B(59) = dA(34)/dV(24)                                            */
+  B[59] = RCT[34]*V[73];
+/* B(60) = dA(34)/dV(73)                                            */
+  B[60] = RCT[34]*V[24];
+/* B(61) = dA(35)/dV(61)                                            */
+  B[61] = RCT[35]*V[62];
+/* B(62) = dA(35)/dV(62)                                            */
+  B[62] = RCT[35]*V[61];
+/* B(63) = dA(36)/dV(62)                                            */
+  B[63] = RCT[36]*2*V[62];
+/* B(64) = dA(37)/dV(62)                                            */
+  B[64] = RCT[37]*2*V[62]*F[2];
+/* B(66) = dA(38)/dV(62)                                            */
+  B[66] = RCT[38]*V[70];
+/* B(67) = dA(38)/dV(70)                                            */
+  B[67] = RCT[38]*V[62];
+/* B(68) = dA(39)/dV(70)                                            */
+  B[68] = RCT[39]*2*V[70];
+/* B(70) = dA(41)/dV(16)                                            */
+  B[70] = RCT[41]*V[73];
+/* B(71) = dA(41)/dV(73)                                            */
+  B[71] = RCT[41]*V[16];
+/* B(72) = dA(42)/dV(62)                                            */
+  B[72] = RCT[42]*V[73];
+/* B(73) = dA(42)/dV(73)                                            */
+  B[73] = RCT[42]*V[62];
+/* B(74) = dA(43)/dV(8)                                             */
+  B[74] = RCT[43]*V[73];
+/* B(75) = dA(43)/dV(73)                                            */
+  B[75] = RCT[43]*V[8];
+/* B(76) = dA(44)/dV(73)                                            */
+  B[76] = RCT[44]*F[3];
+/* B(78) = dA(45)/dV(65)                                            */
+  B[78] = RCT[45]*V[68];
+/* B(79) = dA(45)/dV(68)                                            */
+  B[79] = RCT[45]*V[65];
+/* B(80) = dA(46)/dV(62)                                            */
+  B[80] = RCT[46]*V[65];
+/* B(81) = dA(46)/dV(65)                                            */
+  B[81] = RCT[46]*V[62];
+/* B(82) = dA(47)/dV(65)                                            */
+  B[82] = RCT[47]*V[70];
+/* B(83) = dA(47)/dV(70)                                            */
+  B[83] = RCT[47]*V[65];
+/* B(84) = dA(48)/dV(65)                                            */
+  B[84] = RCT[48]*2*V[65];
+/* B(85) = dA(49)/dV(65)                                            */
+  B[85] = RCT[49]*2*V[65];
+/* B(86) = dA(50)/dV(67)                                            */
+  B[86] = RCT[50]*V[68];
+/* B(87) = dA(50)/dV(68)                                            */
+  B[87] = RCT[50]*V[67];
+/* B(88) = dA(51)/dV(62)                                            */
+  B[88] = RCT[51]*V[67];
+/* B(89) = dA(51)/dV(67)                                            */
+  B[89] = RCT[51]*V[62];
+/* B(90) = dA(52)/dV(67)                                            */
+  B[90] = RCT[52]*V[70];
+/* B(91) = dA(52)/dV(70)                                            */
+  B[91] = RCT[52]*V[67];
+/* B(92) = dA(53)/dV(65)                                            */
+  B[92] = RCT[53]*V[67];
+/* B(93) = dA(53)/dV(67)                                            */
+  B[93] = RCT[53]*V[65];
+/* B(94) = dA(54)/dV(67)                                            */
+  B[94] = RCT[54]*2*V[67];
+/* B(95) = dA(55)/dV(47)                                            */
+  B[95] = RCT[55]*V[68];
+/* B(96) = dA(55)/dV(68)                                            */
+  B[96] = RCT[55]*V[47];
+/* B(97) = dA(56)/dV(47)                                            */
+  B[97] = RCT[56]*V[62];
+/* B(98) = dA(56)/dV(62)                                            */
+  B[98] = RCT[56]*V[47];
+/* B(99) = dA(57)/dV(47)                                            */
+  B[99] = RCT[57]*V[70];
+/* B(100) = dA(57)/dV(70)                                           */
+  B[100] = RCT[57]*V[47];
+/* B(101) = dA(58)/dV(47)                                           */
+  B[101] = RCT[58]*V[65];
+/* B(102) = dA(58)/dV(65)                                           */
+  B[102] = RCT[58]*V[47];
+/* B(103) = dA(59)/dV(47)                                           */
+  B[103] = RCT[59]*V[67];
+/* B(104) = dA(59)/dV(67)                                           */
+  B[104] = RCT[59]*V[47];
+/* B(105) = dA(60)/dV(47)                                           */
+  B[105] = RCT[60]*2*V[47];
+/* B(106) = dA(61)/dV(63)                                           */
+  B[106] = RCT[61]*V[68];
+/* B(107) = dA(61)/dV(68)                                           */
+  B[107] = RCT[61]*V[63];
+/* B(108) = dA(62)/dV(62)                                           */
+  B[108] = RCT[62]*V[63];
+/* B(109) = dA(62)/dV(63)                                           */
+  B[109] = RCT[62]*V[62];
+/* B(110) = dA(63)/dV(63)                                           */
+  B[110] = RCT[63]*V[65];
+/* B(111) = dA(63)/dV(65)                                           */
+  B[111] = RCT[63]*V[63];
+/* B(112) = dA(64)/dV(63)                                           */
+  B[112] = RCT[64]*V[70];
+/* B(113) = dA(64)/dV(70)                                           */
+  B[113] = RCT[64]*V[63];
+/* B(114) = dA(65)/dV(63)                                           */
+  B[114] = RCT[65]*V[67];
+/* B(115) = dA(65)/dV(67)                                           */
+  B[115] = RCT[65]*V[63];
+/* B(116) = dA(66)/dV(47)                                           */
+  B[116] = RCT[66]*V[63];
+/* B(117) = dA(66)/dV(63)                                           */
+  B[117] = RCT[66]*V[47];
+/* B(118) = dA(67)/dV(63)                                           */
+  B[118] = RCT[67]*2*V[63];
+/* B(119) = dA(68)/dV(69)                                           */
+  B[119] = RCT[68]*V[71];
+/* B(120) = dA(68)/dV(71)                                           */
+  B[120] = RCT[68]*V[69];
+/* B(121) = dA(69)/dV(12)                                           */
+  B[121] = RCT[69];
+/* B(122) = dA(70)/dV(68)                                           */
+  B[122] = RCT[70]*V[71];
+/* B(123) = dA(70)/dV(71)                                           */
+  B[123] = RCT[70]*V[68];
+/* B(124) = dA(71)/dV(62)                                           */
+  B[124] = RCT[71]*V[71];
+/* B(125) = dA(71)/dV(71)                                           */
+  B[125] = RCT[71]*V[62];
+/* B(126) = dA(72)/dV(70)                                           */
+  B[126] = RCT[72]*V[71];
+/* B(127) = dA(72)/dV(71)                                           */
+  B[127] = RCT[72]*V[70];
+/* B(128) = dA(73)/dV(65)                                           */
+  B[128] = RCT[73]*V[71];
+/* B(129) = dA(73)/dV(71)                                           */
+  B[129] = RCT[73]*V[65];
+/* B(130) = dA(74)/dV(67)                                           */
+  B[130] = RCT[74]*V[71];
+/* B(131) = dA(74)/dV(71)                                           */
+  B[131] = RCT[74]*V[67];
+/* B(132) = dA(75)/dV(47)                                           */
+  B[132] = RCT[75]*V[71];
+/* B(133) = dA(75)/dV(71)                                           */
+  B[133] = RCT[75]*V[47];
+/* B(134) = dA(76)/dV(63)                                           */
+  B[134] = RCT[76]*V[71];
+/* B(135) = dA(76)/dV(71)                                           */
+  B[135] = RCT[76]*V[63];
+/* B(136) = dA(77)/dV(71)                                           */
+  B[136] = RCT[77]*2*V[71];
+/* B(137) = dA(78)/dV(69)                                           */
+  B[137] = RCT[78]*V[72];
+/* B(138) = dA(78)/dV(72)                                           */
+  B[138] = RCT[78]*V[69];
+/* B(139) = dA(79)/dV(13)                                           */
+  B[139] = RCT[79];
+/* B(140) = dA(80)/dV(68)                                           */
+  B[140] = RCT[80]*V[72];
+/* B(141) = dA(80)/dV(72)                                           */
+  B[141] = RCT[80]*V[68];
+/* B(142) = dA(81)/dV(62)                                           */
+  B[142] = RCT[81]*V[72];
+/* B(143) = dA(81)/dV(72)                                           */
+  B[143] = RCT[81]*V[62];
+/* B(144) = dA(82)/dV(70)                                           */
+  B[144] = RCT[82]*V[72];
+/* B(145) = dA(82)/dV(72)                                           */
+  B[145] = RCT[82]*V[70];
+/* B(146) = dA(83)/dV(65)                                           */
+  B[146] = RCT[83]*V[72];
+/* B(147) = dA(83)/dV(72)                                           */
+  B[147] = RCT[83]*V[65];
+/* B(148) = dA(84)/dV(67)                                           */
+  B[148] = RCT[84]*V[72];
+/* B(149) = dA(84)/dV(72)                                           */
+  B[149] = RCT[84]*V[67];
+/* B(150) = dA(85)/dV(47)                                           */
+  B[150] = RCT[85]*V[72];
+/* B(151) = dA(85)/dV(72)                                           */
+  B[151] = RCT[85]*V[47];
+/* B(152) = dA(86)/dV(63)                                           */
+  B[152] = RCT[86]*V[72];
+/* B(153) = dA(86)/dV(72)                                           */
+  B[153] = RCT[86]*V[63];
+/* B(154) = dA(87)/dV(71)                                           */
+  B[154] = RCT[87]*V[72];
+/* B(155) = dA(87)/dV(72)                                           */
+  B[155] = RCT[87]*V[71];
+/* B(156) = dA(88)/dV(72)                                           */
+  B[156] = RCT[88]*2*V[72];
+/* B(157) = dA(89)/dV(66)                                           */
+  B[157] = RCT[89]*V[69];
+/* B(158) = dA(89)/dV(69)                                           */
+  B[158] = RCT[89]*V[66];
+/* B(159) = dA(90)/dV(14)                                           */
+  B[159] = RCT[90];
+/* B(160) = dA(91)/dV(66)                                           */
+  B[160] = RCT[91]*V[68];
+/* B(161) = dA(91)/dV(68)                                           */
+  B[161] = RCT[91]*V[66];
+/* B(162) = dA(92)/dV(62)                                           */
+  B[162] = RCT[92]*V[66];
+/* B(163) = dA(92)/dV(66)                                           */
+  B[163] = RCT[92]*V[62];
+/* B(164) = dA(93)/dV(66)                                           */
+  B[164] = RCT[93]*V[70];
+/* B(165) = dA(93)/dV(70)                                           */
+  B[165] = RCT[93]*V[66];
+/* B(166) = dA(94)/dV(65)                                           */
+  B[166] = RCT[94]*V[66];
+/* B(167) = dA(94)/dV(66)                                           */
+  B[167] = RCT[94]*V[65];
+/* B(168) = dA(95)/dV(66)                                           */
+  B[168] = RCT[95]*V[67];
+/* B(169) = dA(95)/dV(67)                                           */
+  B[169] = RCT[95]*V[66];
+/* B(170) = dA(96)/dV(47)                                           */
+  B[170] = RCT[96]*V[66];
+/* B(171) = dA(96)/dV(66)                                           */
+  B[171] = RCT[96]*V[47];
+/* B(172) = dA(97)/dV(63)                                           */
+  B[172] = RCT[97]*V[66];
+/* B(173) = dA(97)/dV(66)                                           */
+  B[173] = RCT[97]*V[63];
+/* B(174) = dA(98)/dV(66)                                           */
+  B[174] = RCT[98]*V[71];
+/* B(175) = dA(98)/dV(71)                                           */
+  B[175] = RCT[98]*V[66];
+/* B(176) = dA(99)/dV(66)                                           */
+  B[176] = RCT[99]*V[72];
+/* B(177) = dA(99)/dV(72)                                           */
+  B[177] = RCT[99]*V[66];
+/* B(178) = dA(100)/dV(66)                                          */
+  B[178] = RCT[100]*2*V[66];
+/* B(179) = dA(101)/dV(64)                                          */
+  B[179] = RCT[101]*V[69];
+/* B(180) = dA(101)/dV(69)                                          */
+  B[180] = RCT[101]*V[64];
+/* B(181) = dA(102)/dV(15)                                          */
+  B[181] = RCT[102];
+/* B(182) = dA(103)/dV(64)                                          */
+  B[182] = RCT[103]*V[68];
+/* B(183) = dA(103)/dV(68)                                          */
+  B[183] = RCT[103]*V[64];
+/* B(184) = dA(104)/dV(62)                                          */
+  B[184] = RCT[104]*V[64];
+/* B(185) = dA(104)/dV(64)                                          */
+  B[185] = RCT[104]*V[62];
+/* B(186) = dA(105)/dV(64)                                          */
+  B[186] = RCT[105]*V[70];
+/* B(187) = dA(105)/dV(70)                                          */
+  B[187] = RCT[105]*V[64];
+/* B(188) = dA(106)/dV(64)                                          */
+  B[188] = RCT[106]*V[65];
+/* B(189) = dA(106)/dV(65)                                          */
+  B[189] = RCT[106]*V[64];
+/* B(190) = dA(107)/dV(64)                                          */
+  B[190] = RCT[107]*V[67];
+/* B(191) = dA(107)/dV(67)                                          */
+  B[191] = RCT[107]*V[64];
+/* B(192) = dA(108)/dV(47)                                          */
+  B[192] = RCT[108]*V[64];
+/* B(193) = dA(108)/dV(64)                                          */
+  B[193] = RCT[108]*V[47];
+/* B(194) = dA(109)/dV(63)                                          */
+  B[194] = RCT[109]*V[64];
+/* B(195) = dA(109)/dV(64)                                          */
+  B[195] = RCT[109]*V[63];
+/* B(196) = dA(110)/dV(64)                                          */
+  B[196] = RCT[110]*V[71];
+/* B(197) = dA(110)/dV(71)                                          */
+  B[197] = RCT[110]*V[64];
+/* B(198) = dA(111)/dV(64)                                          */
+  B[198] = RCT[111]*V[72];
+/* B(199) = dA(111)/dV(72)                                          */
+  B[199] = RCT[111]*V[64];
+/* B(200) = dA(112)/dV(64)                                          */
+  B[200] = RCT[112]*V[66];
+/* B(201) = dA(112)/dV(66)                                          */
+  B[201] = RCT[112]*V[64];
+/* B(202) = dA(113)/dV(64)                                          */
+  B[202] = RCT[113]*2*V[64];
+/* B(203) = dA(114)/dV(21)                                          */
+  B[203] = RCT[114]*V[69];
+/* B(204) = dA(114)/dV(69)                                          */
+  B[204] = RCT[114]*V[21];
+/* B(205) = dA(115)/dV(21)                                          */
+  B[205] = RCT[115];
+/* B(206) = dA(116)/dV(45)                                          */
+  B[206] = RCT[116]*V[69];
+/* B(207) = dA(116)/dV(69)                                          */
+  B[207] = RCT[116]*V[45];
+/* B(208) = dA(117)/dV(45)                                          */
+  B[208] = RCT[117]*V[62];
+/* B(209) = dA(117)/dV(62)                                          */
+  B[209] = RCT[117]*V[45];
+/* B(210) = dA(118)/dV(45)                                          */
+  B[210] = RCT[118];
+/* B(211) = dA(119)/dV(27)                                          */
+  B[211] = RCT[119]*V[69];
+/* B(212) = dA(119)/dV(69)                                          */
+  B[212] = RCT[119]*V[27];
+/* B(213) = dA(120)/dV(27)                                          */
+  B[213] = RCT[120]*V[62];
+/* B(214) = dA(120)/dV(62)                                          */
+  B[214] = RCT[120]*V[27];
+/* B(215) = dA(121)/dV(27)                                          */
+  B[215] = RCT[121];
+/* B(218) = dA(124)/dV(55)                                          */
+  B[218] = RCT[124]*V[73];
+/* B(219) = dA(124)/dV(73)                                          */
+  B[219] = RCT[124]*V[55];
+/* B(220) = dA(125)/dV(55)                                          */
+  B[220] = RCT[125]*V[62];
+/* B(221) = dA(125)/dV(62)                                          */
+  B[221] = RCT[125]*V[55];
+/* B(222) = dA(126)/dV(26)                                          */
+  B[222] = RCT[126];
+/* B(223) = dA(127)/dV(26)                                          */
+  B[223] = RCT[127]*V[68];
+/* B(224) = dA(127)/dV(68)                                          */
+  B[224] = RCT[127]*V[26];
+/* B(225) = dA(128)/dV(55)                                          */
+  B[225] = RCT[128]*V[70];
+/* B(226) = dA(128)/dV(70)                                          */
+  B[226] = RCT[128]*V[55];
+/* B(227) = dA(129)/dV(54)                                          */
+  B[227] = RCT[129]*V[73];
+/* B(228) = dA(129)/dV(73)                                          */
+  B[228] = RCT[129]*V[54];
+/* B(230) = dA(131)/dV(54)                                          */
+  B[230] = RCT[131]*V[70];
+/* B(231) = dA(131)/dV(70)                                          */
+  B[231] = RCT[131]*V[54];
+/* B(232) = dA(132)/dV(58)                                          */
+  B[232] = RCT[132]*V[73];
+/* B(233) = dA(132)/dV(73)                                          */
+  B[233] = RCT[132]*V[58];
+/* B(235) = dA(134)/dV(58)                                          */
+  B[235] = RCT[134]*V[70];
+/* B(236) = dA(134)/dV(70)                                          */
+  B[236] = RCT[134]*V[58];
+/* B(237) = dA(135)/dV(41)                                          */
+  B[237] = RCT[135]*V[73];
+/* B(238) = dA(135)/dV(73)                                          */
+  B[238] = RCT[135]*V[41];
+/* B(240) = dA(137)/dV(59)                                          */
+  B[240] = RCT[137]*V[73];
+/* B(241) = dA(137)/dV(73)                                          */
+  B[241] = RCT[137]*V[59];
+/* B(243) = dA(139)/dV(28)                                          */
+  B[243] = RCT[139]*V[73];
+/* B(244) = dA(139)/dV(73)                                          */
+  B[244] = RCT[139]*V[28];
+/* B(245) = dA(140)/dV(25)                                          */
+  B[245] = RCT[140]*V[73];
+/* B(246) = dA(140)/dV(73)                                          */
+  B[246] = RCT[140]*V[25];
+/* B(248) = dA(142)/dV(36)                                          */
+  B[248] = RCT[142]*V[73];
+/* B(249) = dA(142)/dV(73)                                          */
+  B[249] = RCT[142]*V[36];
+/* B(253) = dA(146)/dV(44)                                          */
+  B[253] = RCT[146]*V[73];
+/* B(254) = dA(146)/dV(73)                                          */
+  B[254] = RCT[146]*V[44];
+/* B(255) = dA(147)/dV(44)                                          */
+  B[255] = RCT[147]*V[70];
+/* B(256) = dA(147)/dV(70)                                          */
+  B[256] = RCT[147]*V[44];
+/* B(258) = dA(149)/dV(40)                                          */
+  B[258] = 1.5e-11*V[73];
+/* B(259) = dA(149)/dV(73)                                          */
+  B[259] = 1.5e-11*V[40];
+/* B(260) = dA(150)/dV(40)                                          */
+  B[260] = RCT[150]*V[70];
+/* B(261) = dA(150)/dV(70)                                          */
+  B[261] = RCT[150]*V[40];
+/* B(263) = dA(152)/dV(38)                                          */
+  B[263] = RCT[152]*V[73];
+/* B(264) = dA(152)/dV(73)                                          */
+  B[264] = RCT[152]*V[38];
+/* B(265) = dA(153)/dV(38)                                          */
+  B[265] = RCT[153]*V[70];
+/* B(266) = dA(153)/dV(70)                                          */
+  B[266] = RCT[153]*V[38];
+/* B(267) = dA(154)/dV(33)                                          */
+  B[267] = RCT[154]*V[73];
+/* B(268) = dA(154)/dV(73)                                          */
+  B[268] = RCT[154]*V[33];
+/* B(269) = dA(155)/dV(33)                                          */
+  B[269] = RCT[155]*V[70];
+/* B(270) = dA(155)/dV(70)                                          */
+  B[270] = RCT[155]*V[33];
+/* B(271) = dA(156)/dV(35)                                          */
+  B[271] = RCT[156]*V[70];
+/* B(272) = dA(156)/dV(70)                                          */
+  B[272] = RCT[156]*V[35];
+/* B(273) = dA(157)/dV(37)                                          */
+  B[273] = RCT[157]*V[73];
+/* B(274) = dA(157)/dV(73)                                          */
+  B[274] = RCT[157]*V[37];
+/* B(276) = dA(159)/dV(37)                                          */
+  B[276] = RCT[159]*V[70];
+/* B(277) = dA(159)/dV(70)                                          */
+  B[277] = RCT[159]*V[37];
+/* B(278) = dA(160)/dV(49)                                          */
+  B[278] = RCT[160]*V[73];
+/* B(279) = dA(160)/dV(73)                                          */
+  B[279] = RCT[160]*V[49];
+/* B(280) = dA(161)/dV(49)                                          */
+  B[280] = RCT[161]*V[61];
+/* B(281) = dA(161)/dV(61)                                          */
+  B[281] = RCT[161]*V[49];
+/* B(282) = dA(162)/dV(49)                                          */
+  B[282] = RCT[162]*V[70];
+/* B(283) = dA(162)/dV(70)                                          */
+  B[283] = RCT[162]*V[49];
+/* B(284) = dA(163)/dV(49)                                          */
+  B[284] = RCT[163]*V[57];
+/* B(285) = dA(163)/dV(57)                                          */
+  B[285] = RCT[163]*V[49];
+/* B(287) = dA(165)/dV(53)                                          */
+  B[287] = RCT[165]*V[73];
+/* B(288) = dA(165)/dV(73)                                          */
+  B[288] = RCT[165]*V[53];
+/* B(289) = dA(166)/dV(53)                                          */
+  B[289] = RCT[166]*V[61];
+/* B(290) = dA(166)/dV(61)                                          */
+  B[290] = RCT[166]*V[53];
+/* B(291) = dA(167)/dV(53)                                          */
+  B[291] = RCT[167]*V[57];
+/* B(292) = dA(167)/dV(57)                                          */
+  B[292] = RCT[167]*V[53];
+/* B(294) = dA(169)/dV(51)                                          */
+  B[294] = RCT[169]*V[73];
+/* B(295) = dA(169)/dV(73)                                          */
+  B[295] = RCT[169]*V[51];
+/* B(296) = dA(170)/dV(51)                                          */
+  B[296] = RCT[170]*V[61];
+/* B(297) = dA(170)/dV(61)                                          */
+  B[297] = RCT[170]*V[51];
+/* B(298) = dA(171)/dV(51)                                          */
+  B[298] = RCT[171]*V[70];
+/* B(299) = dA(171)/dV(70)                                          */
+  B[299] = RCT[171]*V[51];
+/* B(301) = dA(173)/dV(60)                                          */
+  B[301] = RCT[173]*V[73];
+/* B(302) = dA(173)/dV(73)                                          */
+  B[302] = RCT[173]*V[60];
+/* B(304) = dA(175)/dV(56)                                          */
+  B[304] = RCT[175]*V[73];
+/* B(305) = dA(175)/dV(73)                                          */
+  B[305] = RCT[175]*V[56];
+/* B(307) = dA(177)/dV(34)                                          */
+  B[307] = RCT[177]*V[73];
+/* B(308) = dA(177)/dV(73)                                          */
+  B[308] = RCT[177]*V[34];
+/* B(309) = dA(178)/dV(34)                                          */
+  B[309] = RCT[178]*V[61];
+/* B(310) = dA(178)/dV(61)                                          */
+  B[310] = RCT[178]*V[34];
+/* B(311) = dA(179)/dV(31)                                          */
+  B[311] = RCT[179]*V[73];
+/* B(312) = dA(179)/dV(73)                                          */
+  B[312] = RCT[179]*V[31];
+/* B(314) = dA(181)/dV(32)                                          */
+  B[314] = RCT[181]*V[73];
+/* B(315) = dA(181)/dV(73)                                          */
+  B[315] = RCT[181]*V[32];
+/* B(317) = dA(183)/dV(73)                                          */
+  B[317] = RCT[183]*F[4];
+/* B(319) = dA(184)/dV(43)                                          */
+  B[319] = RCT[184]*V[73];
+/* B(320) = dA(184)/dV(73)                                          */
+  B[320] = RCT[184]*V[43];
+/* B(321) = dA(185)/dV(43)                                          */
+  B[321] = RCT[185]*V[61];
+/* B(322) = dA(185)/dV(61)                                          */
+  B[322] = RCT[185]*V[43];
+/* B(323) = dA(186)/dV(43)                                          */
+  B[323] = RCT[186]*V[70];
+/* B(324) = dA(186)/dV(70)                                          */
+  B[324] = RCT[186]*V[43];
+/* B(325) = dA(187)/dV(43)                                          */
+  B[325] = RCT[187]*V[57];
+/* B(326) = dA(187)/dV(57)                                          */
+  B[326] = RCT[187]*V[43];
+/* B(327) = dA(188)/dV(46)                                          */
+  B[327] = RCT[188]*V[73];
+/* B(328) = dA(188)/dV(73)                                          */
+  B[328] = RCT[188]*V[46];
+/* B(329) = dA(189)/dV(46)                                          */
+  B[329] = RCT[189]*V[61];
+/* B(330) = dA(189)/dV(61)                                          */
+  B[330] = RCT[189]*V[46];
+/* B(331) = dA(190)/dV(46)                                          */
+  B[331] = RCT[190]*V[70];
+/* B(332) = dA(190)/dV(70)                                          */
+  B[332] = RCT[190]*V[46];
+/* B(333) = dA(191)/dV(46)                                          */
+  B[333] = RCT[191]*V[57];
+/* B(334) = dA(191)/dV(57)                                          */
+  B[334] = RCT[191]*V[46];
+/* B(335) = dA(192)/dV(48)                                          */
+  B[335] = RCT[192]*V[73];
+/* B(336) = dA(192)/dV(73)                                          */
+  B[336] = RCT[192]*V[48];
+/* B(337) = dA(193)/dV(48)                                          */
+  B[337] = RCT[193]*V[61];
+/* B(338) = dA(193)/dV(61)                                          */
+  B[338] = RCT[193]*V[48];
+/* B(339) = dA(194)/dV(48)                                          */
+  B[339] = RCT[194]*V[70];
+/* B(340) = dA(194)/dV(70)                                          */
+  B[340] = RCT[194]*V[48];
+/* B(341) = dA(195)/dV(48)                                          */
+  B[341] = RCT[195]*V[57];
+/* B(342) = dA(195)/dV(57)                                          */
+  B[342] = RCT[195]*V[48];
+/* B(343) = dA(196)/dV(10)                                          */
+  B[343] = RCT[196]*V[73];
+/* B(344) = dA(196)/dV(73)                                          */
+  B[344] = RCT[196]*V[10];
+/* B(345) = dA(197)/dV(19)                                          */
+  B[345] = RCT[197]*V[73];
+/* B(346) = dA(197)/dV(73)                                          */
+  B[346] = RCT[197]*V[19];
+/* B(347) = dA(198)/dV(20)                                          */
+  B[347] = RCT[198]*V[73];
+/* B(348) = dA(198)/dV(73)                                          */
+  B[348] = RCT[198]*V[20];
+/* B(349) = dA(199)/dV(29)                                          */
+  B[349] = RCT[199]*V[73];
+/* B(350) = dA(199)/dV(73)                                          */
+  B[350] = RCT[199]*V[29];
+/* B(351) = dA(200)/dV(22)                                          */
+  B[351] = RCT[200]*V[73];
+/* B(352) = dA(200)/dV(73)                                          */
+  B[352] = RCT[200]*V[22];
+/* B(353) = dA(201)/dV(30)                                          */
+  B[353] = RCT[201]*V[73];
+/* B(354) = dA(201)/dV(73)                                          */
+  B[354] = RCT[201]*V[30];
+/* B(355) = dA(202)/dV(23)                                          */
+  B[355] = RCT[202]*V[73];
+/* B(356) = dA(202)/dV(73)                                          */
+  B[356] = RCT[202]*V[23];
+/* B(357) = dA(203)/dV(50)                                          */
+  B[357] = RCT[203]*V[73];
+/* B(358) = dA(203)/dV(73)                                          */
+  B[358] = RCT[203]*V[50];
+/* B(359) = dA(204)/dV(50)                                          */
+  B[359] = RCT[204]*V[61];
+/* B(360) = dA(204)/dV(61)                                          */
+  B[360] = RCT[204]*V[50];
+/* B(361) = dA(205)/dV(50)                                          */
+  B[361] = RCT[205]*V[70];
+/* B(362) = dA(205)/dV(70)                                          */
+  B[362] = RCT[205]*V[50];
+/* B(363) = dA(206)/dV(50)                                          */
+  B[363] = RCT[206]*V[57];
+/* B(364) = dA(206)/dV(57)                                          */
+  B[364] = RCT[206]*V[50];
+/* B(365) = dA(207)/dV(52)                                          */
+  B[365] = RCT[207]*V[73];
+/* B(366) = dA(207)/dV(73)                                          */
+  B[366] = RCT[207]*V[52];
+/* B(367) = dA(208)/dV(52)                                          */
+  B[367] = RCT[208]*V[61];
+/* B(368) = dA(208)/dV(61)                                          */
+  B[368] = RCT[208]*V[52];
+/* B(369) = dA(209)/dV(52)                                          */
+  B[369] = RCT[209]*V[70];
+/* B(370) = dA(209)/dV(70)                                          */
+  B[370] = RCT[209]*V[52];
+/* B(371) = dA(210)/dV(52)                                          */
+  B[371] = RCT[210]*V[57];
+/* B(372) = dA(210)/dV(57)                                          */
+  B[372] = RCT[210]*V[52];
+
+/* Construct the Jacobian terms from B's                            */
+/* JVS(0) = Jac_FULL(0,0)                                           */
+  JVS[0] = 0;
+/* JVS(1) = Jac_FULL(0,8)                                           */
+  JVS[1] = B[74];
+/* JVS(2) = Jac_FULL(0,73)                                          */
+  JVS[2] = B[75];
+/* JVS(3) = Jac_FULL(1,1)                                           */
+  JVS[3] = 0;
+/* JVS(4) = Jac_FULL(1,19)                                          */
+  JVS[4] = 0.121*B[345];
+/* JVS(5) = Jac_FULL(1,26)                                          */
+  JVS[5] = B[223];
+/* JVS(6) = Jac_FULL(1,43)                                          */
+  JVS[6] = 0.37*B[321];
+/* JVS(7) = Jac_FULL(1,46)                                          */
+  JVS[7] = 0.204*B[329];
+/* JVS(8) = Jac_FULL(1,48)                                          */
+  JVS[8] = 0.103*B[337];
+/* JVS(9) = Jac_FULL(1,49)                                          */
+  JVS[9] = 0.333*B[280];
+/* JVS(10) = Jac_FULL(1,50)                                         */
+  JVS[10] = 0.185*B[359];
+/* JVS(11) = Jac_FULL(1,51)                                         */
+  JVS[11] = 0.1*B[296];
+/* JVS(12) = Jac_FULL(1,52)                                         */
+  JVS[12] = 0.073*B[367];
+/* JVS(13) = Jac_FULL(1,53)                                         */
+  JVS[13] = 0.351*B[289];
+/* JVS(14) = Jac_FULL(1,61)                                         */
+  JVS[14] = 0.333*B[281]+0.351*B[290]+0.1*B[297]+0.37*B[322]+0.204
+           *B[330]+0.103*B[338]+0.185*B[360]+0.073*B[368];
+/* JVS(15) = Jac_FULL(1,68)                                         */
+  JVS[15] = B[224];
+/* JVS(16) = Jac_FULL(1,73)                                         */
+  JVS[16] = 0.121*B[346];
+/* JVS(17) = Jac_FULL(2,2)                                          */
+  JVS[17] = 0;
+/* JVS(18) = Jac_FULL(2,50)                                         */
+  JVS[18] = 0.05*B[359];
+/* JVS(19) = Jac_FULL(2,52)                                         */
+  JVS[19] = 0.129*B[367];
+/* JVS(20) = Jac_FULL(2,61)                                         */
+  JVS[20] = 0.05*B[360]+0.129*B[368];
+/* JVS(21) = Jac_FULL(2,62)                                         */
+  JVS[21] = 0.25*B[124];
+/* JVS(22) = Jac_FULL(2,63)                                         */
+  JVS[22] = B[134];
+/* JVS(23) = Jac_FULL(2,65)                                         */
+  JVS[23] = B[128];
+/* JVS(24) = Jac_FULL(2,67)                                         */
+  JVS[24] = B[130];
+/* JVS(25) = Jac_FULL(2,71)                                         */
+  JVS[25] = 0.25*B[125]+B[129]+B[131]+B[135];
+/* JVS(26) = Jac_FULL(3,3)                                          */
+  JVS[26] = 0;
+/* JVS(27) = Jac_FULL(3,46)                                         */
+  JVS[27] = 0.15*B[329];
+/* JVS(28) = Jac_FULL(3,48)                                         */
+  JVS[28] = 0.189*B[337];
+/* JVS(29) = Jac_FULL(3,50)                                         */
+  JVS[29] = 0.119*B[359];
+/* JVS(30) = Jac_FULL(3,51)                                         */
+  JVS[30] = 0.372*B[296];
+/* JVS(31) = Jac_FULL(3,52)                                         */
+  JVS[31] = 0.247*B[367];
+/* JVS(32) = Jac_FULL(3,61)                                         */
+  JVS[32] = 0.372*B[297]+0.15*B[330]+0.189*B[338]+0.119*B[360]+0.247
+           *B[368];
+/* JVS(33) = Jac_FULL(3,62)                                         */
+  JVS[33] = 0.25*B[142]+0.25*B[162]+0.25*B[184];
+/* JVS(34) = Jac_FULL(3,63)                                         */
+  JVS[34] = B[152]+B[172]+2*B[194];
+/* JVS(35) = Jac_FULL(3,64)                                         */
+  JVS[35] = 0.25*B[185]+B[188]+B[190]+2*B[195];
+/* JVS(36) = Jac_FULL(3,65)                                         */
+  JVS[36] = B[146]+B[166]+B[189];
+/* JVS(37) = Jac_FULL(3,66)                                         */
+  JVS[37] = 0.25*B[163]+B[167]+B[168]+B[173];
+/* JVS(38) = Jac_FULL(3,67)                                         */
+  JVS[38] = B[148]+B[169]+B[191];
+/* JVS(39) = Jac_FULL(3,72)                                         */
+  JVS[39] = 0.25*B[143]+B[147]+B[149]+B[153];
+/* JVS(40) = Jac_FULL(4,4)                                          */
+  JVS[40] = 0;
+/* JVS(41) = Jac_FULL(4,62)                                         */
+  JVS[41] = 0.75*B[124];
+/* JVS(42) = Jac_FULL(4,71)                                         */
+  JVS[42] = 0.75*B[125];
+/* JVS(43) = Jac_FULL(5,5)                                          */
+  JVS[43] = 0;
+/* JVS(44) = Jac_FULL(5,62)                                         */
+  JVS[44] = 0.75*B[142]+0.75*B[162]+0.75*B[184];
+/* JVS(45) = Jac_FULL(5,64)                                         */
+  JVS[45] = 0.75*B[185];
+/* JVS(46) = Jac_FULL(5,66)                                         */
+  JVS[46] = 0.75*B[163];
+/* JVS(47) = Jac_FULL(5,72)                                         */
+  JVS[47] = 0.75*B[143];
+/* JVS(48) = Jac_FULL(6,6)                                          */
+  JVS[48] = 0;
+/* JVS(49) = Jac_FULL(6,27)                                         */
+  JVS[49] = 2*B[211];
+/* JVS(50) = Jac_FULL(6,69)                                         */
+  JVS[50] = 2*B[212];
+/* JVS(51) = Jac_FULL(7,7)                                          */
+  JVS[51] = 0;
+/* JVS(52) = Jac_FULL(7,27)                                         */
+  JVS[52] = 6*B[211];
+/* JVS(53) = Jac_FULL(7,37)                                         */
+  JVS[53] = 0;
+/* JVS(54) = Jac_FULL(7,69)                                         */
+  JVS[54] = 6*B[212];
+/* JVS(55) = Jac_FULL(8,8)                                          */
+  JVS[55] = -B[74];
+/* JVS(56) = Jac_FULL(8,73)                                         */
+  JVS[56] = -B[75];
+/* JVS(57) = Jac_FULL(9,9)                                          */
+  JVS[57] = -B[32]-B[34];
+/* JVS(58) = Jac_FULL(9,61)                                         */
+  JVS[58] = 0;
+/* JVS(59) = Jac_FULL(10,10)                                        */
+  JVS[59] = -B[343];
+/* JVS(60) = Jac_FULL(10,73)                                        */
+  JVS[60] = -B[344];
+/* JVS(61) = Jac_FULL(11,11)                                        */
+  JVS[61] = 0;
+/* JVS(62) = Jac_FULL(11,23)                                        */
+  JVS[62] = 0.087*B[355];
+/* JVS(63) = Jac_FULL(11,48)                                        */
+  JVS[63] = 0.031*B[337];
+/* JVS(64) = Jac_FULL(11,61)                                        */
+  JVS[64] = 0.031*B[338];
+/* JVS(65) = Jac_FULL(11,73)                                        */
+  JVS[65] = 0.087*B[356];
+/* JVS(66) = Jac_FULL(12,12)                                        */
+  JVS[66] = -B[121];
+/* JVS(67) = Jac_FULL(12,69)                                        */
+  JVS[67] = B[119];
+/* JVS(68) = Jac_FULL(12,71)                                        */
+  JVS[68] = B[120];
+/* JVS(69) = Jac_FULL(13,13)                                        */
+  JVS[69] = -B[139];
+/* JVS(70) = Jac_FULL(13,69)                                        */
+  JVS[70] = B[137];
+/* JVS(71) = Jac_FULL(13,72)                                        */
+  JVS[71] = B[138];
+/* JVS(72) = Jac_FULL(14,14)                                        */
+  JVS[72] = -B[159];
+/* JVS(73) = Jac_FULL(14,66)                                        */
+  JVS[73] = B[157];
+/* JVS(74) = Jac_FULL(14,69)                                        */
+  JVS[74] = B[158];
+/* JVS(75) = Jac_FULL(15,15)                                        */
+  JVS[75] = -B[181];
+/* JVS(76) = Jac_FULL(15,64)                                        */
+  JVS[76] = B[179];
+/* JVS(77) = Jac_FULL(15,69)                                        */
+  JVS[77] = B[180];
+/* JVS(78) = Jac_FULL(16,16)                                        */
+  JVS[78] = -B[70];
+/* JVS(79) = Jac_FULL(16,62)                                        */
+  JVS[79] = B[63]+B[64];
+/* JVS(80) = Jac_FULL(16,73)                                        */
+  JVS[80] = -B[71];
+/* JVS(81) = Jac_FULL(17,17)                                        */
+  JVS[81] = -B[23]-B[24];
+/* JVS(82) = Jac_FULL(17,69)                                        */
+  JVS[82] = B[21];
+/* JVS(83) = Jac_FULL(17,70)                                        */
+  JVS[83] = B[22];
+/* JVS(84) = Jac_FULL(18,18)                                        */
+  JVS[84] = -B[40];
+/* JVS(85) = Jac_FULL(18,68)                                        */
+  JVS[85] = B[36];
+/* JVS(86) = Jac_FULL(18,73)                                        */
+  JVS[86] = B[37]-B[41];
+/* JVS(87) = Jac_FULL(19,19)                                        */
+  JVS[87] = -B[345];
+/* JVS(88) = Jac_FULL(19,73)                                        */
+  JVS[88] = -B[346];
+/* JVS(89) = Jac_FULL(20,20)                                        */
+  JVS[89] = -B[347];
+/* JVS(90) = Jac_FULL(20,73)                                        */
+  JVS[90] = -B[348];
+/* JVS(91) = Jac_FULL(21,20)                                        */
+  JVS[91] = 0.236*B[347];
+/* JVS(92) = Jac_FULL(21,21)                                        */
+  JVS[92] = -B[203]-B[205];
+/* JVS(93) = Jac_FULL(21,69)                                        */
+  JVS[93] = -B[204];
+/* JVS(94) = Jac_FULL(21,73)                                        */
+  JVS[94] = 0.236*B[348];
+/* JVS(95) = Jac_FULL(22,22)                                        */
+  JVS[95] = -B[351];
+/* JVS(96) = Jac_FULL(22,73)                                        */
+  JVS[96] = -B[352];
+/* JVS(97) = Jac_FULL(23,23)                                        */
+  JVS[97] = -B[355];
+/* JVS(98) = Jac_FULL(23,73)                                        */
+  JVS[98] = -B[356];
+/* JVS(99) = Jac_FULL(24,24)                                        */
+  JVS[99] = -B[57]-B[59];
+/* JVS(100) = Jac_FULL(24,62)                                       */
+  JVS[100] = B[55];
+/* JVS(101) = Jac_FULL(24,69)                                       */
+  JVS[101] = B[56];
+/* JVS(102) = Jac_FULL(24,73)                                       */
+  JVS[102] = -B[60];
+/* JVS(103) = Jac_FULL(25,25)                                       */
+  JVS[103] = -B[245];
+/* JVS(104) = Jac_FULL(25,62)                                       */
+  JVS[104] = B[80];
+/* JVS(105) = Jac_FULL(25,65)                                       */
+  JVS[105] = B[81];
+/* JVS(106) = Jac_FULL(25,73)                                       */
+  JVS[106] = -B[246];
+/* JVS(107) = Jac_FULL(26,26)                                       */
+  JVS[107] = -B[222]-B[223];
+/* JVS(108) = Jac_FULL(26,55)                                       */
+  JVS[108] = B[220];
+/* JVS(109) = Jac_FULL(26,62)                                       */
+  JVS[109] = B[221];
+/* JVS(110) = Jac_FULL(26,68)                                       */
+  JVS[110] = -B[224];
+/* JVS(111) = Jac_FULL(27,27)                                       */
+  JVS[111] = -B[211]-B[213]-B[215];
+/* JVS(112) = Jac_FULL(27,35)                                       */
+  JVS[112] = B[271];
+/* JVS(113) = Jac_FULL(27,62)                                       */
+  JVS[113] = -B[214];
+/* JVS(114) = Jac_FULL(27,69)                                       */
+  JVS[114] = -B[212];
+/* JVS(115) = Jac_FULL(27,70)                                       */
+  JVS[115] = B[272];
+/* JVS(116) = Jac_FULL(28,28)                                       */
+  JVS[116] = -B[243];
+/* JVS(117) = Jac_FULL(28,63)                                       */
+  JVS[117] = 0.25*B[110];
+/* JVS(118) = Jac_FULL(28,65)                                       */
+  JVS[118] = B[84]+0.25*B[92]+0.25*B[111];
+/* JVS(119) = Jac_FULL(28,67)                                       */
+  JVS[119] = 0.25*B[93];
+/* JVS(120) = Jac_FULL(28,73)                                       */
+  JVS[120] = -B[244];
+/* JVS(121) = Jac_FULL(29,29)                                       */
+  JVS[121] = -B[349];
+/* JVS(122) = Jac_FULL(29,73)                                       */
+  JVS[122] = -B[350];
+/* JVS(123) = Jac_FULL(30,30)                                       */
+  JVS[123] = -B[353];
+/* JVS(124) = Jac_FULL(30,73)                                       */
+  JVS[124] = -B[354];
+/* JVS(125) = Jac_FULL(31,23)                                       */
+  JVS[125] = 0.099*B[355];
+/* JVS(126) = Jac_FULL(31,30)                                       */
+  JVS[126] = 0.108*B[353];
+/* JVS(127) = Jac_FULL(31,31)                                       */
+  JVS[127] = -B[311];
+/* JVS(128) = Jac_FULL(31,73)                                       */
+  JVS[128] = -B[312]+0.108*B[354]+0.099*B[356];
+/* JVS(129) = Jac_FULL(32,23)                                       */
+  JVS[129] = 0.093*B[355];
+/* JVS(130) = Jac_FULL(32,30)                                       */
+  JVS[130] = 0.051*B[353];
+/* JVS(131) = Jac_FULL(32,32)                                       */
+  JVS[131] = -B[314];
+/* JVS(132) = Jac_FULL(32,73)                                       */
+  JVS[132] = -B[315]+0.051*B[354]+0.093*B[356];
+/* JVS(133) = Jac_FULL(33,23)                                       */
+  JVS[133] = 0.187*B[355];
+/* JVS(134) = Jac_FULL(33,30)                                       */
+  JVS[134] = 0.207*B[353];
+/* JVS(135) = Jac_FULL(33,33)                                       */
+  JVS[135] = -B[267]-B[269];
+/* JVS(136) = Jac_FULL(33,70)                                       */
+  JVS[136] = -B[270];
+/* JVS(137) = Jac_FULL(33,73)                                       */
+  JVS[137] = -B[268]+0.207*B[354]+0.187*B[356];
+/* JVS(138) = Jac_FULL(34,23)                                       */
+  JVS[138] = 0.561*B[355];
+/* JVS(139) = Jac_FULL(34,30)                                       */
+  JVS[139] = 0.491*B[353];
+/* JVS(140) = Jac_FULL(34,34)                                       */
+  JVS[140] = -B[307]-B[309];
+/* JVS(141) = Jac_FULL(34,61)                                       */
+  JVS[141] = -B[310];
+/* JVS(142) = Jac_FULL(34,73)                                       */
+  JVS[142] = -B[308]+0.491*B[354]+0.561*B[356];
+/* JVS(143) = Jac_FULL(35,27)                                       */
+  JVS[143] = B[213]+B[215];
+/* JVS(144) = Jac_FULL(35,35)                                       */
+  JVS[144] = -B[271];
+/* JVS(145) = Jac_FULL(35,45)                                       */
+  JVS[145] = B[206];
+/* JVS(146) = Jac_FULL(35,62)                                       */
+  JVS[146] = B[214];
+/* JVS(147) = Jac_FULL(35,69)                                       */
+  JVS[147] = B[207];
+/* JVS(148) = Jac_FULL(35,70)                                       */
+  JVS[148] = -B[272];
+/* JVS(149) = Jac_FULL(36,36)                                       */
+  JVS[149] = -B[248];
+/* JVS(150) = Jac_FULL(36,62)                                       */
+  JVS[150] = B[88]+B[108];
+/* JVS(151) = Jac_FULL(36,63)                                       */
+  JVS[151] = B[109];
+/* JVS(152) = Jac_FULL(36,67)                                       */
+  JVS[152] = B[89];
+/* JVS(153) = Jac_FULL(36,73)                                       */
+  JVS[153] = -B[249];
+/* JVS(154) = Jac_FULL(37,23)                                       */
+  JVS[154] = 0.05*B[355];
+/* JVS(155) = Jac_FULL(37,30)                                       */
+  JVS[155] = 0.059*B[353];
+/* JVS(156) = Jac_FULL(37,37)                                       */
+  JVS[156] = -B[273]-B[276];
+/* JVS(157) = Jac_FULL(37,52)                                       */
+  JVS[157] = 0.061*B[365]+0.042*B[367]+0.015*B[369];
+/* JVS(158) = Jac_FULL(37,61)                                       */
+  JVS[158] = 0.042*B[368];
+/* JVS(159) = Jac_FULL(37,70)                                       */
+  JVS[159] = -B[277]+0.015*B[370];
+/* JVS(160) = Jac_FULL(37,73)                                       */
+  JVS[160] = -B[274]+0.059*B[354]+0.05*B[356]+0.061*B[366];
+/* JVS(161) = Jac_FULL(38,30)                                       */
+  JVS[161] = 0.017*B[353];
+/* JVS(162) = Jac_FULL(38,38)                                       */
+  JVS[162] = -B[263]-B[265];
+/* JVS(163) = Jac_FULL(38,45)                                       */
+  JVS[163] = B[208]+B[210];
+/* JVS(164) = Jac_FULL(38,62)                                       */
+  JVS[164] = B[209];
+/* JVS(165) = Jac_FULL(38,70)                                       */
+  JVS[165] = -B[266];
+/* JVS(166) = Jac_FULL(38,73)                                       */
+  JVS[166] = -B[264]+0.017*B[354];
+/* JVS(167) = Jac_FULL(39,19)                                       */
+  JVS[167] = 0.16*B[345];
+/* JVS(168) = Jac_FULL(39,29)                                       */
+  JVS[168] = 0.002*B[349];
+/* JVS(169) = Jac_FULL(39,31)                                       */
+  JVS[169] = 0;
+/* JVS(170) = Jac_FULL(39,32)                                       */
+  JVS[170] = 0;
+/* JVS(171) = Jac_FULL(39,34)                                       */
+  JVS[171] = B[307]+1.5*B[309];
+/* JVS(172) = Jac_FULL(39,39)                                       */
+  JVS[172] = -B[49];
+/* JVS(173) = Jac_FULL(39,40)                                       */
+  JVS[173] = B[258]+B[260];
+/* JVS(174) = Jac_FULL(39,43)                                       */
+  JVS[174] = 0.5*B[321]+0.491*B[325];
+/* JVS(175) = Jac_FULL(39,44)                                       */
+  JVS[175] = 1.26*B[253]+1.26*B[255];
+/* JVS(176) = Jac_FULL(39,46)                                       */
+  JVS[176] = 0.275*B[329];
+/* JVS(177) = Jac_FULL(39,48)                                       */
+  JVS[177] = 0.157*B[337];
+/* JVS(178) = Jac_FULL(39,49)                                       */
+  JVS[178] = 0.416*B[278]+0.45*B[280]+0.5*B[282];
+/* JVS(179) = Jac_FULL(39,50)                                       */
+  JVS[179] = 0.345*B[359];
+/* JVS(180) = Jac_FULL(39,51)                                       */
+  JVS[180] = 0.336*B[294]+0.498*B[296]+0.572*B[298];
+/* JVS(181) = Jac_FULL(39,52)                                       */
+  JVS[181] = 0.265*B[367]+0.012*B[371];
+/* JVS(182) = Jac_FULL(39,53)                                       */
+  JVS[182] = 0.475*B[289];
+/* JVS(183) = Jac_FULL(39,54)                                       */
+  JVS[183] = 0;
+/* JVS(184) = Jac_FULL(39,55)                                       */
+  JVS[184] = B[218]+B[225];
+/* JVS(185) = Jac_FULL(39,57)                                       */
+  JVS[185] = 0.491*B[326]+0.012*B[372];
+/* JVS(186) = Jac_FULL(39,58)                                       */
+  JVS[186] = 0.034*B[232];
+/* JVS(187) = Jac_FULL(39,61)                                       */
+  JVS[187] = 0.45*B[281]+0.475*B[290]+0.498*B[297]+1.5*B[310]+0.5
+            *B[322]+0.275*B[330]+0.157*B[338]+0.345*B[360]+0.265*B[368];
+/* JVS(188) = Jac_FULL(39,70)                                       */
+  JVS[188] = B[226]+1.26*B[256]+B[261]+0.5*B[283]+0.572*B[299];
+/* JVS(189) = Jac_FULL(39,73)                                       */
+  JVS[189] = -B[50]+B[219]+0.034*B[233]+1.26*B[254]+B[259]+0.416*B[279]
+            +0.336*B[295]+B[308]+0.16*B[346]+0.002*B[350];
+/* JVS(190) = Jac_FULL(40,23)                                       */
+  JVS[190] = 0.287*B[355];
+/* JVS(191) = Jac_FULL(40,30)                                       */
+  JVS[191] = 0.119*B[353];
+/* JVS(192) = Jac_FULL(40,31)                                       */
+  JVS[192] = 0;
+/* JVS(193) = Jac_FULL(40,32)                                       */
+  JVS[193] = 0;
+/* JVS(194) = Jac_FULL(40,33)                                       */
+  JVS[194] = 0.23*B[267];
+/* JVS(195) = Jac_FULL(40,40)                                       */
+  JVS[195] = -B[258]-B[260];
+/* JVS(196) = Jac_FULL(40,49)                                       */
+  JVS[196] = 0.084*B[278]+0.9*B[280];
+/* JVS(197) = Jac_FULL(40,51)                                       */
+  JVS[197] = 0.174*B[294]+0.742*B[296]+0.008*B[298];
+/* JVS(198) = Jac_FULL(40,53)                                       */
+  JVS[198] = 0.3*B[287]+0.95*B[289];
+/* JVS(199) = Jac_FULL(40,61)                                       */
+  JVS[199] = 0.9*B[281]+0.95*B[290]+0.742*B[297];
+/* JVS(200) = Jac_FULL(40,70)                                       */
+  JVS[200] = -B[261]+0.008*B[299];
+/* JVS(201) = Jac_FULL(40,73)                                       */
+  JVS[201] = -B[259]+0.23*B[268]+0.084*B[279]+0.3*B[288]+0.174*B[295]
+            +0.119*B[354]+0.287*B[356];
+/* JVS(202) = Jac_FULL(41,19)                                       */
+  JVS[202] = 0.417*B[345];
+/* JVS(203) = Jac_FULL(41,20)                                       */
+  JVS[203] = 0.024*B[347];
+/* JVS(204) = Jac_FULL(41,21)                                       */
+  JVS[204] = B[205];
+/* JVS(205) = Jac_FULL(41,22)                                       */
+  JVS[205] = 0.072*B[351];
+/* JVS(206) = Jac_FULL(41,29)                                       */
+  JVS[206] = 0.452*B[349];
+/* JVS(207) = Jac_FULL(41,41)                                       */
+  JVS[207] = -B[237];
+/* JVS(208) = Jac_FULL(41,48)                                       */
+  JVS[208] = 0.13*B[337];
+/* JVS(209) = Jac_FULL(41,50)                                       */
+  JVS[209] = 0.005*B[357]+0.001*B[359]+0.024*B[361];
+/* JVS(210) = Jac_FULL(41,52)                                       */
+  JVS[210] = 0.127*B[365]+0.045*B[367]+0.102*B[369];
+/* JVS(211) = Jac_FULL(41,56)                                       */
+  JVS[211] = 0.006*B[304];
+/* JVS(212) = Jac_FULL(41,61)                                       */
+  JVS[212] = 0.13*B[338]+0.001*B[360]+0.045*B[368];
+/* JVS(213) = Jac_FULL(41,69)                                       */
+  JVS[213] = 0;
+/* JVS(214) = Jac_FULL(41,70)                                       */
+  JVS[214] = 0.024*B[362]+0.102*B[370];
+/* JVS(215) = Jac_FULL(41,73)                                       */
+  JVS[215] = -B[238]+0.006*B[305]+0.417*B[346]+0.024*B[348]+0.452
+            *B[350]+0.072*B[352]+0.005*B[358]+0.127*B[366];
+/* JVS(216) = Jac_FULL(42,17)                                       */
+  JVS[216] = 2*B[24];
+/* JVS(217) = Jac_FULL(42,33)                                       */
+  JVS[217] = B[269];
+/* JVS(218) = Jac_FULL(42,35)                                       */
+  JVS[218] = B[271];
+/* JVS(219) = Jac_FULL(42,37)                                       */
+  JVS[219] = B[276];
+/* JVS(220) = Jac_FULL(42,38)                                       */
+  JVS[220] = B[265];
+/* JVS(221) = Jac_FULL(42,40)                                       */
+  JVS[221] = B[260];
+/* JVS(222) = Jac_FULL(42,42)                                       */
+  JVS[222] = -B[46];
+/* JVS(223) = Jac_FULL(42,44)                                       */
+  JVS[223] = B[255];
+/* JVS(224) = Jac_FULL(42,45)                                       */
+  JVS[224] = 0;
+/* JVS(225) = Jac_FULL(42,49)                                       */
+  JVS[225] = 0.5*B[282];
+/* JVS(226) = Jac_FULL(42,51)                                       */
+  JVS[226] = 0.15*B[298];
+/* JVS(227) = Jac_FULL(42,52)                                       */
+  JVS[227] = 0;
+/* JVS(228) = Jac_FULL(42,53)                                       */
+  JVS[228] = 0;
+/* JVS(229) = Jac_FULL(42,54)                                       */
+  JVS[229] = B[230];
+/* JVS(230) = Jac_FULL(42,55)                                       */
+  JVS[230] = B[225];
+/* JVS(231) = Jac_FULL(42,58)                                       */
+  JVS[231] = B[235];
+/* JVS(232) = Jac_FULL(42,61)                                       */
+  JVS[232] = 0;
+/* JVS(233) = Jac_FULL(42,62)                                       */
+  JVS[233] = 0.2*B[66];
+/* JVS(234) = Jac_FULL(42,69)                                       */
+  JVS[234] = B[42];
+/* JVS(235) = Jac_FULL(42,70)                                       */
+  JVS[235] = 0.2*B[67]+B[226]+B[231]+B[236]+B[256]+B[261]+B[266]+B[270]
+            +B[272]+B[277]+0.5*B[283]+0.15*B[299];
+/* JVS(236) = Jac_FULL(42,73)                                       */
+  JVS[236] = B[43]-B[47];
+/* JVS(237) = Jac_FULL(43,43)                                       */
+  JVS[237] = -B[319]-B[321]-B[323]-B[325];
+/* JVS(238) = Jac_FULL(43,57)                                       */
+  JVS[238] = -B[326];
+/* JVS(239) = Jac_FULL(43,61)                                       */
+  JVS[239] = -B[322];
+/* JVS(240) = Jac_FULL(43,70)                                       */
+  JVS[240] = -B[324];
+/* JVS(241) = Jac_FULL(43,73)                                       */
+  JVS[241] = -B[320];
+/* JVS(242) = Jac_FULL(44,19)                                       */
+  JVS[242] = 0.248*B[345];
+/* JVS(243) = Jac_FULL(44,23)                                       */
+  JVS[243] = 0.097*B[355];
+/* JVS(244) = Jac_FULL(44,30)                                       */
+  JVS[244] = 0.118*B[353];
+/* JVS(245) = Jac_FULL(44,31)                                       */
+  JVS[245] = 0;
+/* JVS(246) = Jac_FULL(44,32)                                       */
+  JVS[246] = 0;
+/* JVS(247) = Jac_FULL(44,34)                                       */
+  JVS[247] = B[309];
+/* JVS(248) = Jac_FULL(44,38)                                       */
+  JVS[248] = 0.23*B[263];
+/* JVS(249) = Jac_FULL(44,43)                                       */
+  JVS[249] = 0.009*B[325];
+/* JVS(250) = Jac_FULL(44,44)                                       */
+  JVS[250] = -B[253]-B[255];
+/* JVS(251) = Jac_FULL(44,45)                                       */
+  JVS[251] = 0;
+/* JVS(252) = Jac_FULL(44,48)                                       */
+  JVS[252] = 0.001*B[337];
+/* JVS(253) = Jac_FULL(44,51)                                       */
+  JVS[253] = 0.15*B[294]+0.023*B[296];
+/* JVS(254) = Jac_FULL(44,57)                                       */
+  JVS[254] = 0.009*B[326];
+/* JVS(255) = Jac_FULL(44,61)                                       */
+  JVS[255] = 0.023*B[297]+B[310]+0.001*B[338];
+/* JVS(256) = Jac_FULL(44,62)                                       */
+  JVS[256] = 0;
+/* JVS(257) = Jac_FULL(44,70)                                       */
+  JVS[257] = -B[256];
+/* JVS(258) = Jac_FULL(44,73)                                       */
+  JVS[258] = -B[254]+0.23*B[264]+0.15*B[295]+0.248*B[346]+0.118*B[354]
+            +0.097*B[356];
+/* JVS(259) = Jac_FULL(45,33)                                       */
+  JVS[259] = 0.24*B[267]+B[269];
+/* JVS(260) = Jac_FULL(45,38)                                       */
+  JVS[260] = 0.24*B[263]+B[265];
+/* JVS(261) = Jac_FULL(45,45)                                       */
+  JVS[261] = -B[206]-B[208]-B[210];
+/* JVS(262) = Jac_FULL(45,62)                                       */
+  JVS[262] = -B[209];
+/* JVS(263) = Jac_FULL(45,64)                                       */
+  JVS[263] = B[200];
+/* JVS(264) = Jac_FULL(45,66)                                       */
+  JVS[264] = B[160]+B[164]+B[174]+B[176]+2*B[178]+B[201];
+/* JVS(265) = Jac_FULL(45,68)                                       */
+  JVS[265] = B[161];
+/* JVS(266) = Jac_FULL(45,69)                                       */
+  JVS[266] = -B[207];
+/* JVS(267) = Jac_FULL(45,70)                                       */
+  JVS[267] = B[165]+B[266]+B[270];
+/* JVS(268) = Jac_FULL(45,71)                                       */
+  JVS[268] = B[175];
+/* JVS(269) = Jac_FULL(45,72)                                       */
+  JVS[269] = B[177];
+/* JVS(270) = Jac_FULL(45,73)                                       */
+  JVS[270] = 0.24*B[264]+0.24*B[268];
+/* JVS(271) = Jac_FULL(46,46)                                       */
+  JVS[271] = -B[327]-B[329]-B[331]-B[333];
+/* JVS(272) = Jac_FULL(46,57)                                       */
+  JVS[272] = -B[334];
+/* JVS(273) = Jac_FULL(46,61)                                       */
+  JVS[273] = -B[330];
+/* JVS(274) = Jac_FULL(46,70)                                       */
+  JVS[274] = -B[332];
+/* JVS(275) = Jac_FULL(46,73)                                       */
+  JVS[275] = -B[328];
+/* JVS(276) = Jac_FULL(47,20)                                       */
+  JVS[276] = 0.559*B[347];
+/* JVS(277) = Jac_FULL(47,22)                                       */
+  JVS[277] = 0.948*B[351];
+/* JVS(278) = Jac_FULL(47,29)                                       */
+  JVS[278] = 0.936*B[349];
+/* JVS(279) = Jac_FULL(47,31)                                       */
+  JVS[279] = B[311];
+/* JVS(280) = Jac_FULL(47,32)                                       */
+  JVS[280] = B[314];
+/* JVS(281) = Jac_FULL(47,41)                                       */
+  JVS[281] = B[237];
+/* JVS(282) = Jac_FULL(47,46)                                       */
+  JVS[282] = 0.079*B[327]+0.126*B[329]+0.187*B[331]+0.24*B[333];
+/* JVS(283) = Jac_FULL(47,47)                                       */
+  JVS[283] = -B[95]-B[97]-B[99]-B[101]-B[103]-B[116]-B[132]-B[150]
+            -B[170]-B[192];
+/* JVS(284) = Jac_FULL(47,48)                                       */
+  JVS[284] = 0.5*B[335]+0.729*B[337]+0.75*B[339];
+/* JVS(285) = Jac_FULL(47,50)                                       */
+  JVS[285] = 0.205*B[357]+0.488*B[361];
+/* JVS(286) = Jac_FULL(47,52)                                       */
+  JVS[286] = 0.001*B[365]+0.137*B[367]+0.711*B[369];
+/* JVS(287) = Jac_FULL(47,53)                                       */
+  JVS[287] = 0.675*B[287];
+/* JVS(288) = Jac_FULL(47,56)                                       */
+  JVS[288] = 0.596*B[304];
+/* JVS(289) = Jac_FULL(47,57)                                       */
+  JVS[289] = 0.24*B[334];
+/* JVS(290) = Jac_FULL(47,59)                                       */
+  JVS[290] = 0.616*B[240];
+/* JVS(291) = Jac_FULL(47,60)                                       */
+  JVS[291] = 0;
+/* JVS(292) = Jac_FULL(47,61)                                       */
+  JVS[292] = 0.126*B[330]+0.729*B[338]+0.137*B[368];
+/* JVS(293) = Jac_FULL(47,62)                                       */
+  JVS[293] = -B[98];
+/* JVS(294) = Jac_FULL(47,63)                                       */
+  JVS[294] = -B[117];
+/* JVS(295) = Jac_FULL(47,64)                                       */
+  JVS[295] = -B[193]+B[200];
+/* JVS(296) = Jac_FULL(47,65)                                       */
+  JVS[296] = -B[102];
+/* JVS(297) = Jac_FULL(47,66)                                       */
+  JVS[297] = B[160]+B[164]-B[171]+B[174]+B[176]+2*B[178]+B[201];
+/* JVS(298) = Jac_FULL(47,67)                                       */
+  JVS[298] = -B[104];
+/* JVS(299) = Jac_FULL(47,68)                                       */
+  JVS[299] = -B[96]+B[161];
+/* JVS(300) = Jac_FULL(47,69)                                       */
+  JVS[300] = 0;
+/* JVS(301) = Jac_FULL(47,70)                                       */
+  JVS[301] = -B[100]+B[165]+0.187*B[332]+0.75*B[340]+0.488*B[362]+0.711
+            *B[370];
+/* JVS(302) = Jac_FULL(47,71)                                       */
+  JVS[302] = -B[133]+B[175];
+/* JVS(303) = Jac_FULL(47,72)                                       */
+  JVS[303] = -B[151]+B[177];
+/* JVS(304) = Jac_FULL(47,73)                                       */
+  JVS[304] = B[238]+0.616*B[241]+0.675*B[288]+0.596*B[305]+B[312]
+            +B[315]+0.079*B[328]+0.5*B[336]+0.559*B[348]+0.936*B[350]
+            +0.948*B[352]+0.205*B[358]+0.001*B[366];
+/* JVS(305) = Jac_FULL(48,48)                                       */
+  JVS[305] = -B[335]-B[337]-B[339]-B[341];
+/* JVS(306) = Jac_FULL(48,57)                                       */
+  JVS[306] = -B[342];
+/* JVS(307) = Jac_FULL(48,61)                                       */
+  JVS[307] = -B[338];
+/* JVS(308) = Jac_FULL(48,70)                                       */
+  JVS[308] = -B[340];
+/* JVS(309) = Jac_FULL(48,73)                                       */
+  JVS[309] = -B[336];
+/* JVS(310) = Jac_FULL(49,46)                                       */
+  JVS[310] = 0.23*B[327]+0.39*B[329];
+/* JVS(311) = Jac_FULL(49,49)                                       */
+  JVS[311] = -B[278]-B[280]-B[282]-B[284];
+/* JVS(312) = Jac_FULL(49,52)                                       */
+  JVS[312] = 0.025*B[365]+0.026*B[367]+0.012*B[371];
+/* JVS(313) = Jac_FULL(49,57)                                       */
+  JVS[313] = -B[285]+0.012*B[372];
+/* JVS(314) = Jac_FULL(49,61)                                       */
+  JVS[314] = -B[281]+0.39*B[330]+0.026*B[368];
+/* JVS(315) = Jac_FULL(49,70)                                       */
+  JVS[315] = -B[283];
+/* JVS(316) = Jac_FULL(49,73)                                       */
+  JVS[316] = -B[279]+0.23*B[328]+0.025*B[366];
+/* JVS(317) = Jac_FULL(50,50)                                       */
+  JVS[317] = -B[357]-B[359]-B[361]-B[363];
+/* JVS(318) = Jac_FULL(50,57)                                       */
+  JVS[318] = -B[364];
+/* JVS(319) = Jac_FULL(50,61)                                       */
+  JVS[319] = -B[360];
+/* JVS(320) = Jac_FULL(50,70)                                       */
+  JVS[320] = -B[362];
+/* JVS(321) = Jac_FULL(50,73)                                       */
+  JVS[321] = -B[358];
+/* JVS(322) = Jac_FULL(51,46)                                       */
+  JVS[322] = 0.357*B[327]+0.936*B[331];
+/* JVS(323) = Jac_FULL(51,51)                                       */
+  JVS[323] = -B[294]-B[296]-B[298];
+/* JVS(324) = Jac_FULL(51,52)                                       */
+  JVS[324] = 0.025*B[365];
+/* JVS(325) = Jac_FULL(51,57)                                       */
+  JVS[325] = 0;
+/* JVS(326) = Jac_FULL(51,61)                                       */
+  JVS[326] = -B[297];
+/* JVS(327) = Jac_FULL(51,70)                                       */
+  JVS[327] = -B[299]+0.936*B[332];
+/* JVS(328) = Jac_FULL(51,73)                                       */
+  JVS[328] = -B[295]+0.357*B[328]+0.025*B[366];
+/* JVS(329) = Jac_FULL(52,52)                                       */
+  JVS[329] = -B[365]-B[367]-B[369]-B[371];
+/* JVS(330) = Jac_FULL(52,57)                                       */
+  JVS[330] = -B[372];
+/* JVS(331) = Jac_FULL(52,61)                                       */
+  JVS[331] = -B[368];
+/* JVS(332) = Jac_FULL(52,70)                                       */
+  JVS[332] = -B[370];
+/* JVS(333) = Jac_FULL(52,73)                                       */
+  JVS[333] = -B[366];
+/* JVS(334) = Jac_FULL(53,46)                                       */
+  JVS[334] = 0.32*B[327]+0.16*B[329];
+/* JVS(335) = Jac_FULL(53,52)                                       */
+  JVS[335] = 0.019*B[367]+0.048*B[369];
+/* JVS(336) = Jac_FULL(53,53)                                       */
+  JVS[336] = -B[287]-B[289]-B[291];
+/* JVS(337) = Jac_FULL(53,57)                                       */
+  JVS[337] = -B[292];
+/* JVS(338) = Jac_FULL(53,61)                                       */
+  JVS[338] = -B[290]+0.16*B[330]+0.019*B[368];
+/* JVS(339) = Jac_FULL(53,70)                                       */
+  JVS[339] = 0.048*B[370];
+/* JVS(340) = Jac_FULL(53,73)                                       */
+  JVS[340] = -B[288]+0.32*B[328];
+/* JVS(341) = Jac_FULL(54,10)                                       */
+  JVS[341] = B[343];
+/* JVS(342) = Jac_FULL(54,20)                                       */
+  JVS[342] = 0.445*B[347];
+/* JVS(343) = Jac_FULL(54,22)                                       */
+  JVS[343] = 0.099*B[351];
+/* JVS(344) = Jac_FULL(54,29)                                       */
+  JVS[344] = 0.455*B[349];
+/* JVS(345) = Jac_FULL(54,43)                                       */
+  JVS[345] = 0.195*B[319]+0.25*B[325];
+/* JVS(346) = Jac_FULL(54,50)                                       */
+  JVS[346] = 0.294*B[357]+0.154*B[359]+0.009*B[361];
+/* JVS(347) = Jac_FULL(54,51)                                       */
+  JVS[347] = 0.129*B[294]+0.047*B[296];
+/* JVS(348) = Jac_FULL(54,52)                                       */
+  JVS[348] = 0.732*B[365]+0.456*B[367]+0.507*B[369];
+/* JVS(349) = Jac_FULL(54,54)                                       */
+  JVS[349] = -B[227]-B[230];
+/* JVS(350) = Jac_FULL(54,56)                                       */
+  JVS[350] = 0.439*B[304];
+/* JVS(351) = Jac_FULL(54,57)                                       */
+  JVS[351] = 0.25*B[326];
+/* JVS(352) = Jac_FULL(54,58)                                       */
+  JVS[352] = 0.034*B[232];
+/* JVS(353) = Jac_FULL(54,59)                                       */
+  JVS[353] = 0.482*B[240];
+/* JVS(354) = Jac_FULL(54,60)                                       */
+  JVS[354] = 0.084*B[301];
+/* JVS(355) = Jac_FULL(54,61)                                       */
+  JVS[355] = 0.047*B[297]+0.154*B[360]+0.456*B[368];
+/* JVS(356) = Jac_FULL(54,64)                                       */
+  JVS[356] = B[198];
+/* JVS(357) = Jac_FULL(54,66)                                       */
+  JVS[357] = B[176];
+/* JVS(358) = Jac_FULL(54,68)                                       */
+  JVS[358] = B[140];
+/* JVS(359) = Jac_FULL(54,70)                                       */
+  JVS[359] = B[144]-B[231]+0.009*B[362]+0.507*B[370];
+/* JVS(360) = Jac_FULL(54,71)                                       */
+  JVS[360] = B[154];
+/* JVS(361) = Jac_FULL(54,72)                                       */
+  JVS[361] = B[141]+B[145]+B[155]+2*B[156]+B[177]+B[199];
+/* JVS(362) = Jac_FULL(54,73)                                       */
+  JVS[362] = -B[228]+0.034*B[233]+0.482*B[241]+0.129*B[295]+0.084
+            *B[302]+0.439*B[305]+0.195*B[320]+B[344]+0.445*B[348]+0.455
+            *B[350]+0.099*B[352]+0.294*B[358]+0.732*B[366];
+/* JVS(363) = Jac_FULL(55,19)                                       */
+  JVS[363] = 0.039*B[345];
+/* JVS(364) = Jac_FULL(55,20)                                       */
+  JVS[364] = 0.026*B[347];
+/* JVS(365) = Jac_FULL(55,22)                                       */
+  JVS[365] = 0.026*B[351];
+/* JVS(366) = Jac_FULL(55,25)                                       */
+  JVS[366] = 0.35*B[245];
+/* JVS(367) = Jac_FULL(55,26)                                       */
+  JVS[367] = B[222];
+/* JVS(368) = Jac_FULL(55,28)                                       */
+  JVS[368] = B[243];
+/* JVS(369) = Jac_FULL(55,29)                                       */
+  JVS[369] = 0.024*B[349];
+/* JVS(370) = Jac_FULL(55,41)                                       */
+  JVS[370] = B[237];
+/* JVS(371) = Jac_FULL(55,43)                                       */
+  JVS[371] = 1.61*B[319]+B[321]+0.191*B[325];
+/* JVS(372) = Jac_FULL(55,44)                                       */
+  JVS[372] = 0;
+/* JVS(373) = Jac_FULL(55,45)                                       */
+  JVS[373] = 0;
+/* JVS(374) = Jac_FULL(55,46)                                       */
+  JVS[374] = 0.624*B[327]+0.592*B[329]+0.24*B[333];
+/* JVS(375) = Jac_FULL(55,48)                                       */
+  JVS[375] = 0.276*B[335]+0.235*B[337];
+/* JVS(376) = Jac_FULL(55,49)                                       */
+  JVS[376] = 0.084*B[278]+0.2*B[280];
+/* JVS(377) = Jac_FULL(55,50)                                       */
+  JVS[377] = 0.732*B[357]+0.5*B[359];
+/* JVS(378) = Jac_FULL(55,51)                                       */
+  JVS[378] = 0.055*B[294]+0.125*B[296]+0.227*B[298];
+/* JVS(379) = Jac_FULL(55,52)                                       */
+  JVS[379] = 0.244*B[365]+0.269*B[367]+0.079*B[369];
+/* JVS(380) = Jac_FULL(55,53)                                       */
+  JVS[380] = 0.3*B[287]+0.1*B[289];
+/* JVS(381) = Jac_FULL(55,55)                                       */
+  JVS[381] = -B[218]-B[220]-B[225];
+/* JVS(382) = Jac_FULL(55,56)                                       */
+  JVS[382] = 0.01*B[304];
+/* JVS(383) = Jac_FULL(55,57)                                       */
+  JVS[383] = 0.191*B[326]+0.24*B[334];
+/* JVS(384) = Jac_FULL(55,59)                                       */
+  JVS[384] = 0.115*B[240];
+/* JVS(385) = Jac_FULL(55,60)                                       */
+  JVS[385] = 0.213*B[301];
+/* JVS(386) = Jac_FULL(55,61)                                       */
+  JVS[386] = 0.2*B[281]+0.1*B[290]+0.125*B[297]+B[322]+0.592*B[330]
+            +0.235*B[338]+0.5*B[360]+0.269*B[368];
+/* JVS(387) = Jac_FULL(55,62)                                       */
+  JVS[387] = -B[221];
+/* JVS(388) = Jac_FULL(55,63)                                       */
+  JVS[388] = 0.75*B[110];
+/* JVS(389) = Jac_FULL(55,64)                                       */
+  JVS[389] = B[182]+B[186]+B[188]+B[196]+B[198]+B[200]+2*B[202];
+/* JVS(390) = Jac_FULL(55,65)                                       */
+  JVS[390] = B[78]+B[82]+B[84]+2*B[85]+0.75*B[92]+0.75*B[111]+B[128]
+            +B[146]+B[166]+B[189];
+/* JVS(391) = Jac_FULL(55,66)                                       */
+  JVS[391] = B[167]+B[201];
+/* JVS(392) = Jac_FULL(55,67)                                       */
+  JVS[392] = 0.75*B[93];
+/* JVS(393) = Jac_FULL(55,68)                                       */
+  JVS[393] = B[79]+B[183];
+/* JVS(394) = Jac_FULL(55,69)                                       */
+  JVS[394] = 0;
+/* JVS(395) = Jac_FULL(55,70)                                       */
+  JVS[395] = B[83]+B[187]-B[226]+0.227*B[299]+0.079*B[370];
+/* JVS(396) = Jac_FULL(55,71)                                       */
+  JVS[396] = B[129]+B[197];
+/* JVS(397) = Jac_FULL(55,72)                                       */
+  JVS[397] = B[147]+B[199];
+/* JVS(398) = Jac_FULL(55,73)                                       */
+  JVS[398] = -B[219]+B[238]+0.115*B[241]+B[244]+0.35*B[246]+0.084
+            *B[279]+0.3*B[288]+0.055*B[295]+0.213*B[302]+0.01*B[305]
+            +1.61*B[320]+0.624*B[328]+0.276*B[336]+0.039*B[346]+0.026
+            *B[348]+0.024*B[350]+0.026*B[352]+0.732*B[358]+0.244*B[366];
+/* JVS(399) = Jac_FULL(56,21)                                       */
+  JVS[399] = B[203];
+/* JVS(400) = Jac_FULL(56,48)                                       */
+  JVS[400] = 0.276*B[339];
+/* JVS(401) = Jac_FULL(56,50)                                       */
+  JVS[401] = 0.511*B[361];
+/* JVS(402) = Jac_FULL(56,51)                                       */
+  JVS[402] = 0.572*B[298];
+/* JVS(403) = Jac_FULL(56,52)                                       */
+  JVS[403] = 0.321*B[369];
+/* JVS(404) = Jac_FULL(56,56)                                       */
+  JVS[404] = -0.69*B[304];
+/* JVS(405) = Jac_FULL(56,57)                                       */
+  JVS[405] = 0;
+/* JVS(406) = Jac_FULL(56,61)                                       */
+  JVS[406] = 0;
+/* JVS(407) = Jac_FULL(56,63)                                       */
+  JVS[407] = B[106];
+/* JVS(408) = Jac_FULL(56,68)                                       */
+  JVS[408] = B[107];
+/* JVS(409) = Jac_FULL(56,69)                                       */
+  JVS[409] = B[204];
+/* JVS(410) = Jac_FULL(56,70)                                       */
+  JVS[410] = 0.572*B[299]+0.276*B[340]+0.511*B[362]+0.321*B[370];
+/* JVS(411) = Jac_FULL(56,73)                                       */
+  JVS[411] = -0.69*B[305];
+/* JVS(412) = Jac_FULL(57,9)                                        */
+  JVS[412] = B[34];
+/* JVS(413) = Jac_FULL(57,43)                                       */
+  JVS[413] = -B[325];
+/* JVS(414) = Jac_FULL(57,46)                                       */
+  JVS[414] = -B[333];
+/* JVS(415) = Jac_FULL(57,48)                                       */
+  JVS[415] = -B[341];
+/* JVS(416) = Jac_FULL(57,49)                                       */
+  JVS[416] = -B[284];
+/* JVS(417) = Jac_FULL(57,50)                                       */
+  JVS[417] = -B[363];
+/* JVS(418) = Jac_FULL(57,52)                                       */
+  JVS[418] = -B[371];
+/* JVS(419) = Jac_FULL(57,53)                                       */
+  JVS[419] = -B[291];
+/* JVS(420) = Jac_FULL(57,57)                                       */
+  JVS[420] = -B[1]-B[4]-B[6]-B[9]-B[11]-B[285]-B[292]-B[326]-B[334]
+            -B[342]-B[364]-B[372];
+/* JVS(421) = Jac_FULL(57,61)                                       */
+  JVS[421] = -B[5];
+/* JVS(422) = Jac_FULL(57,68)                                       */
+  JVS[422] = -B[7];
+/* JVS(423) = Jac_FULL(57,69)                                       */
+  JVS[423] = -B[10]-B[12];
+/* JVS(424) = Jac_FULL(57,70)                                       */
+  JVS[424] = 0;
+/* JVS(425) = Jac_FULL(57,73)                                       */
+  JVS[425] = 0;
+/* JVS(426) = Jac_FULL(58,19)                                       */
+  JVS[426] = 0.155*B[345];
+/* JVS(427) = Jac_FULL(58,20)                                       */
+  JVS[427] = 0.122*B[347];
+/* JVS(428) = Jac_FULL(58,22)                                       */
+  JVS[428] = 0.204*B[351];
+/* JVS(429) = Jac_FULL(58,29)                                       */
+  JVS[429] = 0.244*B[349];
+/* JVS(430) = Jac_FULL(58,31)                                       */
+  JVS[430] = B[311];
+/* JVS(431) = Jac_FULL(58,32)                                       */
+  JVS[431] = B[314];
+/* JVS(432) = Jac_FULL(58,34)                                       */
+  JVS[432] = B[307];
+/* JVS(433) = Jac_FULL(58,36)                                       */
+  JVS[433] = B[248];
+/* JVS(434) = Jac_FULL(58,43)                                       */
+  JVS[434] = B[323];
+/* JVS(435) = Jac_FULL(58,48)                                       */
+  JVS[435] = 0.474*B[335]+0.205*B[337]+0.474*B[339]+0.147*B[341];
+/* JVS(436) = Jac_FULL(58,49)                                       */
+  JVS[436] = B[284];
+/* JVS(437) = Jac_FULL(58,50)                                       */
+  JVS[437] = 0.497*B[357]+0.363*B[359]+0.037*B[361]+0.45*B[363];
+/* JVS(438) = Jac_FULL(58,51)                                       */
+  JVS[438] = 0.013*B[294]+0.218*B[298];
+/* JVS(439) = Jac_FULL(58,52)                                       */
+  JVS[439] = 0.511*B[365]+0.305*B[367]+0.151*B[369]+0.069*B[371];
+/* JVS(440) = Jac_FULL(58,53)                                       */
+  JVS[440] = 0.675*B[287]+0.45*B[291];
+/* JVS(441) = Jac_FULL(58,56)                                       */
+  JVS[441] = 0.213*B[304];
+/* JVS(442) = Jac_FULL(58,57)                                       */
+  JVS[442] = B[285]+0.45*B[292]+0.147*B[342]+0.45*B[364]+0.069*B[372];
+/* JVS(443) = Jac_FULL(58,58)                                       */
+  JVS[443] = -B[232]-B[235];
+/* JVS(444) = Jac_FULL(58,59)                                       */
+  JVS[444] = 0.37*B[240];
+/* JVS(445) = Jac_FULL(58,60)                                       */
+  JVS[445] = 0.558*B[301];
+/* JVS(446) = Jac_FULL(58,61)                                       */
+  JVS[446] = 0.205*B[338]+0.363*B[360]+0.305*B[368];
+/* JVS(447) = Jac_FULL(58,62)                                       */
+  JVS[447] = 0;
+/* JVS(448) = Jac_FULL(58,63)                                       */
+  JVS[448] = 0;
+/* JVS(449) = Jac_FULL(58,67)                                       */
+  JVS[449] = 0;
+/* JVS(450) = Jac_FULL(58,68)                                       */
+  JVS[450] = 0;
+/* JVS(451) = Jac_FULL(58,69)                                       */
+  JVS[451] = 0;
+/* JVS(452) = Jac_FULL(58,70)                                       */
+  JVS[452] = -B[236]+0.218*B[299]+B[324]+0.474*B[340]+0.037*B[362]
+            +0.151*B[370];
+/* JVS(453) = Jac_FULL(58,73)                                       */
+  JVS[453] = -B[233]+0.37*B[241]+B[249]+0.675*B[288]+0.013*B[295]+0.558
+            *B[302]+0.213*B[305]+B[308]+B[312]+B[315]+0.474*B[336]
+            +0.155*B[346]+0.122*B[348]+0.244*B[350]+0.204*B[352]+0.497
+            *B[358]+0.511*B[366];
+/* JVS(454) = Jac_FULL(59,20)                                       */
+  JVS[454] = 0.332*B[347];
+/* JVS(455) = Jac_FULL(59,22)                                       */
+  JVS[455] = 0.089*B[351];
+/* JVS(456) = Jac_FULL(59,29)                                       */
+  JVS[456] = 0.11*B[349];
+/* JVS(457) = Jac_FULL(59,49)                                       */
+  JVS[457] = 0.416*B[278];
+/* JVS(458) = Jac_FULL(59,50)                                       */
+  JVS[458] = 0.437*B[363];
+/* JVS(459) = Jac_FULL(59,51)                                       */
+  JVS[459] = 0.15*B[294]+0.21*B[296];
+/* JVS(460) = Jac_FULL(59,52)                                       */
+  JVS[460] = 0.072*B[365]+0.026*B[367]+0.001*B[369]+0.659*B[371];
+/* JVS(461) = Jac_FULL(59,53)                                       */
+  JVS[461] = 0.55*B[291];
+/* JVS(462) = Jac_FULL(59,56)                                       */
+  JVS[462] = 0.177*B[304];
+/* JVS(463) = Jac_FULL(59,57)                                       */
+  JVS[463] = 0.55*B[292]+0.437*B[364]+0.659*B[372];
+/* JVS(464) = Jac_FULL(59,59)                                       */
+  JVS[464] = -B[240];
+/* JVS(465) = Jac_FULL(59,60)                                       */
+  JVS[465] = 0.115*B[301];
+/* JVS(466) = Jac_FULL(59,61)                                       */
+  JVS[466] = 0.21*B[297]+0.026*B[368];
+/* JVS(467) = Jac_FULL(59,63)                                       */
+  JVS[467] = 0.5*B[110]+B[112]+0.5*B[114]+B[118];
+/* JVS(468) = Jac_FULL(59,65)                                       */
+  JVS[468] = 0.5*B[111];
+/* JVS(469) = Jac_FULL(59,67)                                       */
+  JVS[469] = 0.5*B[115];
+/* JVS(470) = Jac_FULL(59,68)                                       */
+  JVS[470] = 0;
+/* JVS(471) = Jac_FULL(59,69)                                       */
+  JVS[471] = 0;
+/* JVS(472) = Jac_FULL(59,70)                                       */
+  JVS[472] = B[113]+0.001*B[370];
+/* JVS(473) = Jac_FULL(59,73)                                       */
+  JVS[473] = -B[241]+0.416*B[279]+0.15*B[295]+0.115*B[302]+0.177*B[305]
+            +0.332*B[348]+0.11*B[350]+0.089*B[352]+0.072*B[366];
+/* JVS(474) = Jac_FULL(60,22)                                       */
+  JVS[474] = 0.417*B[351];
+/* JVS(475) = Jac_FULL(60,29)                                       */
+  JVS[475] = 0.125*B[349];
+/* JVS(476) = Jac_FULL(60,30)                                       */
+  JVS[476] = 0.055*B[353];
+/* JVS(477) = Jac_FULL(60,46)                                       */
+  JVS[477] = 0.1*B[329]+0.75*B[333];
+/* JVS(478) = Jac_FULL(60,48)                                       */
+  JVS[478] = 0.276*B[335]+0.276*B[337]+0.853*B[341];
+/* JVS(479) = Jac_FULL(60,50)                                       */
+  JVS[479] = 0.119*B[357]+0.215*B[359]+0.113*B[363];
+/* JVS(480) = Jac_FULL(60,51)                                       */
+  JVS[480] = 0.332*B[294];
+/* JVS(481) = Jac_FULL(60,52)                                       */
+  JVS[481] = 0.043*B[367]+0.259*B[371];
+/* JVS(482) = Jac_FULL(60,53)                                       */
+  JVS[482] = 0;
+/* JVS(483) = Jac_FULL(60,56)                                       */
+  JVS[483] = 0.048*B[304];
+/* JVS(484) = Jac_FULL(60,57)                                       */
+  JVS[484] = 0.75*B[334]+0.853*B[342]+0.113*B[364]+0.259*B[372];
+/* JVS(485) = Jac_FULL(60,60)                                       */
+  JVS[485] = -0.671*B[301];
+/* JVS(486) = Jac_FULL(60,61)                                       */
+  JVS[486] = 0.1*B[330]+0.276*B[338]+0.215*B[360]+0.043*B[368];
+/* JVS(487) = Jac_FULL(60,63)                                       */
+  JVS[487] = 0.5*B[110]+0.5*B[114]+B[118]+B[134]+B[152]+B[172];
+/* JVS(488) = Jac_FULL(60,65)                                       */
+  JVS[488] = 0.5*B[111];
+/* JVS(489) = Jac_FULL(60,66)                                       */
+  JVS[489] = B[173];
+/* JVS(490) = Jac_FULL(60,67)                                       */
+  JVS[490] = 0.5*B[115];
+/* JVS(491) = Jac_FULL(60,68)                                       */
+  JVS[491] = 0;
+/* JVS(492) = Jac_FULL(60,69)                                       */
+  JVS[492] = 0;
+/* JVS(493) = Jac_FULL(60,70)                                       */
+  JVS[493] = 0;
+/* JVS(494) = Jac_FULL(60,71)                                       */
+  JVS[494] = B[135];
+/* JVS(495) = Jac_FULL(60,72)                                       */
+  JVS[495] = B[153];
+/* JVS(496) = Jac_FULL(60,73)                                       */
+  JVS[496] = 0.332*B[295]-0.671*B[302]+0.048*B[305]+0.276*B[336]+0.125
+            *B[350]+0.417*B[352]+0.055*B[354]+0.119*B[358];
+/* JVS(497) = Jac_FULL(61,34)                                       */
+  JVS[497] = -B[309];
+/* JVS(498) = Jac_FULL(61,43)                                       */
+  JVS[498] = -B[321];
+/* JVS(499) = Jac_FULL(61,46)                                       */
+  JVS[499] = -B[329];
+/* JVS(500) = Jac_FULL(61,48)                                       */
+  JVS[500] = -B[337];
+/* JVS(501) = Jac_FULL(61,49)                                       */
+  JVS[501] = -B[280];
+/* JVS(502) = Jac_FULL(61,50)                                       */
+  JVS[502] = -B[359];
+/* JVS(503) = Jac_FULL(61,51)                                       */
+  JVS[503] = -B[296];
+/* JVS(504) = Jac_FULL(61,52)                                       */
+  JVS[504] = -B[367];
+/* JVS(505) = Jac_FULL(61,53)                                       */
+  JVS[505] = -B[289];
+/* JVS(506) = Jac_FULL(61,57)                                       */
+  JVS[506] = B[1]-B[4];
+/* JVS(507) = Jac_FULL(61,61)                                       */
+  JVS[507] = -B[5]-B[13]-B[15]-B[51]-B[61]-B[281]-B[290]-B[297]-B[310]
+           -B[322]-B[330]-B[338]-B[360]-B[368];
+/* JVS(508) = Jac_FULL(61,62)                                       */
+  JVS[508] = -B[62]+0.25*B[124]+0.25*B[142]+0.25*B[162]+0.25*B[184];
+/* JVS(509) = Jac_FULL(61,64)                                       */
+  JVS[509] = 0.25*B[185];
+/* JVS(510) = Jac_FULL(61,66)                                       */
+  JVS[510] = 0.25*B[163];
+/* JVS(511) = Jac_FULL(61,68)                                       */
+  JVS[511] = -B[14];
+/* JVS(512) = Jac_FULL(61,69)                                       */
+  JVS[512] = -B[16];
+/* JVS(513) = Jac_FULL(61,70)                                       */
+  JVS[513] = 0;
+/* JVS(514) = Jac_FULL(61,71)                                       */
+  JVS[514] = 0.25*B[125];
+/* JVS(515) = Jac_FULL(61,72)                                       */
+  JVS[515] = 0.25*B[143];
+/* JVS(516) = Jac_FULL(61,73)                                       */
+  JVS[516] = -B[52];
+/* JVS(517) = Jac_FULL(62,8)                                        */
+  JVS[517] = B[74];
+/* JVS(518) = Jac_FULL(62,16)                                       */
+  JVS[518] = B[70];
+/* JVS(519) = Jac_FULL(62,18)                                       */
+  JVS[519] = 0;
+/* JVS(520) = Jac_FULL(62,19)                                       */
+  JVS[520] = 0.121*B[345];
+/* JVS(521) = Jac_FULL(62,23)                                       */
+  JVS[521] = 0.187*B[355];
+/* JVS(522) = Jac_FULL(62,24)                                       */
+  JVS[522] = B[57];
+/* JVS(523) = Jac_FULL(62,25)                                       */
+  JVS[523] = 0;
+/* JVS(524) = Jac_FULL(62,26)                                       */
+  JVS[524] = B[222]+B[223];
+/* JVS(525) = Jac_FULL(62,27)                                       */
+  JVS[525] = -B[213];
+/* JVS(526) = Jac_FULL(62,28)                                       */
+  JVS[526] = B[243];
+/* JVS(527) = Jac_FULL(62,30)                                       */
+  JVS[527] = 0.224*B[353];
+/* JVS(528) = Jac_FULL(62,31)                                       */
+  JVS[528] = 0;
+/* JVS(529) = Jac_FULL(62,32)                                       */
+  JVS[529] = 0;
+/* JVS(530) = Jac_FULL(62,34)                                       */
+  JVS[530] = 1.5*B[309];
+/* JVS(531) = Jac_FULL(62,35)                                       */
+  JVS[531] = 0;
+/* JVS(532) = Jac_FULL(62,36)                                       */
+  JVS[532] = 0;
+/* JVS(533) = Jac_FULL(62,39)                                       */
+  JVS[533] = B[49];
+/* JVS(534) = Jac_FULL(62,40)                                       */
+  JVS[534] = 0;
+/* JVS(535) = Jac_FULL(62,43)                                       */
+  JVS[535] = 0.12*B[321]+0.5*B[325];
+/* JVS(536) = Jac_FULL(62,44)                                       */
+  JVS[536] = 0.63*B[253]+0.63*B[255];
+/* JVS(537) = Jac_FULL(62,45)                                       */
+  JVS[537] = -B[208];
+/* JVS(538) = Jac_FULL(62,46)                                       */
+  JVS[538] = 0;
+/* JVS(539) = Jac_FULL(62,48)                                       */
+  JVS[539] = 0.033*B[337];
+/* JVS(540) = Jac_FULL(62,49)                                       */
+  JVS[540] = 0.008*B[280];
+/* JVS(541) = Jac_FULL(62,50)                                       */
+  JVS[541] = 0.056*B[359];
+/* JVS(542) = Jac_FULL(62,51)                                       */
+  JVS[542] = 0.4*B[296];
+/* JVS(543) = Jac_FULL(62,52)                                       */
+  JVS[543] = 0.003*B[367]+0.013*B[371];
+/* JVS(544) = Jac_FULL(62,53)                                       */
+  JVS[544] = 0.064*B[289];
+/* JVS(545) = Jac_FULL(62,54)                                       */
+  JVS[545] = 0;
+/* JVS(546) = Jac_FULL(62,55)                                       */
+  JVS[546] = B[218]-B[220]+B[225];
+/* JVS(547) = Jac_FULL(62,56)                                       */
+  JVS[547] = 0.113*B[304];
+/* JVS(548) = Jac_FULL(62,57)                                       */
+  JVS[548] = 0.5*B[326]+0.013*B[372];
+/* JVS(549) = Jac_FULL(62,58)                                       */
+  JVS[549] = 0;
+/* JVS(550) = Jac_FULL(62,59)                                       */
+  JVS[550] = 0;
+/* JVS(551) = Jac_FULL(62,60)                                       */
+  JVS[551] = 0.379*B[301];
+/* JVS(552) = Jac_FULL(62,61)                                       */
+  JVS[552] = B[51]-B[61]+0.008*B[281]+0.064*B[290]+0.4*B[297]+1.5
+            *B[310]+0.12*B[322]+0.033*B[338]+0.056*B[360]+0.003*B[368];
+/* JVS(553) = Jac_FULL(62,62)                                       */
+  JVS[553] = -B[53]-B[55]-B[62]-2*B[63]-2*B[64]-B[66]-B[72]-B[80]-B[88]
+            -B[108]-B[124]-B[142]-B[162]-B[184]-B[209]-B[214]-B[221];
+/* JVS(554) = Jac_FULL(62,63)                                       */
+  JVS[554] = -B[109]+B[110]+B[112]+B[114]+B[118];
+/* JVS(555) = Jac_FULL(62,64)                                       */
+  JVS[555] = -B[185];
+/* JVS(556) = Jac_FULL(62,65)                                       */
+  JVS[556] = B[78]-B[81]+B[82]+2*B[85]+B[92]+B[111];
+/* JVS(557) = Jac_FULL(62,66)                                       */
+  JVS[557] = -B[163];
+/* JVS(558) = Jac_FULL(62,67)                                       */
+  JVS[558] = B[86]-B[89]+B[90]+B[93]+B[94]+B[115];
+/* JVS(559) = Jac_FULL(62,68)                                       */
+  JVS[559] = -B[54]+B[79]+B[87]+B[224];
+/* JVS(560) = Jac_FULL(62,69)                                       */
+  JVS[560] = -B[56];
+/* JVS(561) = Jac_FULL(62,70)                                       */
+  JVS[561] = B[44]-B[67]+B[83]+B[91]+B[113]+B[226]+0.63*B[256];
+/* JVS(562) = Jac_FULL(62,71)                                       */
+  JVS[562] = -B[125];
+/* JVS(563) = Jac_FULL(62,72)                                       */
+  JVS[563] = -B[143];
+/* JVS(564) = Jac_FULL(62,73)                                       */
+  JVS[564] = B[45]+B[50]+B[52]+B[71]-B[73]+B[75]+B[76]+B[219]+B[244]
+            +0.63*B[254]+0.379*B[302]+0.113*B[305]+0.121*B[346]+0.224
+            *B[354]+0.187*B[356];
+/* JVS(565) = Jac_FULL(63,19)                                       */
+  JVS[565] = 0.021*B[345];
+/* JVS(566) = Jac_FULL(63,20)                                       */
+  JVS[566] = 0.07*B[347];
+/* JVS(567) = Jac_FULL(63,22)                                       */
+  JVS[567] = 0.347*B[351];
+/* JVS(568) = Jac_FULL(63,23)                                       */
+  JVS[568] = 0.009*B[355];
+/* JVS(569) = Jac_FULL(63,29)                                       */
+  JVS[569] = 0.143*B[349];
+/* JVS(570) = Jac_FULL(63,30)                                       */
+  JVS[570] = 0.011*B[353];
+/* JVS(571) = Jac_FULL(63,46)                                       */
+  JVS[571] = 0.093*B[327]+0.008*B[329]+0.064*B[331]+0.01*B[333];
+/* JVS(572) = Jac_FULL(63,48)                                       */
+  JVS[572] = 0.25*B[335]+0.18*B[337]+0.25*B[339];
+/* JVS(573) = Jac_FULL(63,50)                                       */
+  JVS[573] = 0.09*B[357]+0.001*B[359]+0.176*B[361];
+/* JVS(574) = Jac_FULL(63,51)                                       */
+  JVS[574] = 0.041*B[294]+0.051*B[298];
+/* JVS(575) = Jac_FULL(63,52)                                       */
+  JVS[575] = 0.082*B[365]+0.002*B[367]+0.136*B[369]+0.001*B[371];
+/* JVS(576) = Jac_FULL(63,53)                                       */
+  JVS[576] = 0.025*B[287];
+/* JVS(577) = Jac_FULL(63,56)                                       */
+  JVS[577] = 0.173*B[304];
+/* JVS(578) = Jac_FULL(63,57)                                       */
+  JVS[578] = 0.01*B[334]+0.001*B[372];
+/* JVS(579) = Jac_FULL(63,58)                                       */
+  JVS[579] = 0.001*B[232];
+/* JVS(580) = Jac_FULL(63,59)                                       */
+  JVS[580] = 0.042*B[240];
+/* JVS(581) = Jac_FULL(63,60)                                       */
+  JVS[581] = 0.07*B[301];
+/* JVS(582) = Jac_FULL(63,61)                                       */
+  JVS[582] = 0.008*B[330]+0.18*B[338]+0.001*B[360]+0.002*B[368];
+/* JVS(583) = Jac_FULL(63,62)                                       */
+  JVS[583] = -B[108];
+/* JVS(584) = Jac_FULL(63,63)                                       */
+  JVS[584] = -B[106]-B[109]-B[110]-B[112]-B[114]-2*B[118]-B[134]-B[152]
+            -B[172]-B[194];
+/* JVS(585) = Jac_FULL(63,64)                                       */
+  JVS[585] = -B[195];
+/* JVS(586) = Jac_FULL(63,65)                                       */
+  JVS[586] = -B[111];
+/* JVS(587) = Jac_FULL(63,66)                                       */
+  JVS[587] = -B[173];
+/* JVS(588) = Jac_FULL(63,67)                                       */
+  JVS[588] = -B[115];
+/* JVS(589) = Jac_FULL(63,68)                                       */
+  JVS[589] = -B[107];
+/* JVS(590) = Jac_FULL(63,69)                                       */
+  JVS[590] = 0;
+/* JVS(591) = Jac_FULL(63,70)                                       */
+  JVS[591] = -B[113]+0.051*B[299]+0.064*B[332]+0.25*B[340]+0.176*B[362]
+            +0.136*B[370];
+/* JVS(592) = Jac_FULL(63,71)                                       */
+  JVS[592] = -B[135];
+/* JVS(593) = Jac_FULL(63,72)                                       */
+  JVS[593] = -B[153];
+/* JVS(594) = Jac_FULL(63,73)                                       */
+  JVS[594] = 0.001*B[233]+0.042*B[241]+0.025*B[288]+0.041*B[295]+0.07
+            *B[302]+0.173*B[305]+0.093*B[328]+0.25*B[336]+0.021*B[346]
+            +0.07*B[348]+0.143*B[350]+0.347*B[352]+0.011*B[354]+0.009
+            *B[356]+0.09*B[358]+0.082*B[366];
+/* JVS(595) = Jac_FULL(64,15)                                       */
+  JVS[595] = B[181];
+/* JVS(596) = Jac_FULL(64,46)                                       */
+  JVS[596] = 0.192*B[329]+0.24*B[333];
+/* JVS(597) = Jac_FULL(64,49)                                       */
+  JVS[597] = 0.5*B[278]+0.5*B[282];
+/* JVS(598) = Jac_FULL(64,51)                                       */
+  JVS[598] = 0.289*B[294]+0.15*B[298];
+/* JVS(599) = Jac_FULL(64,52)                                       */
+  JVS[599] = 0;
+/* JVS(600) = Jac_FULL(64,53)                                       */
+  JVS[600] = 0;
+/* JVS(601) = Jac_FULL(64,57)                                       */
+  JVS[601] = 0.24*B[334];
+/* JVS(602) = Jac_FULL(64,61)                                       */
+  JVS[602] = 0.192*B[330];
+/* JVS(603) = Jac_FULL(64,62)                                       */
+  JVS[603] = -B[184];
+/* JVS(604) = Jac_FULL(64,63)                                       */
+  JVS[604] = -B[194];
+/* JVS(605) = Jac_FULL(64,64)                                       */
+  JVS[605] = -B[179]-B[182]-B[185]-B[186]-B[188]-B[190]-B[195]-B[196]
+            -B[198]-B[200]-2*B[202];
+/* JVS(606) = Jac_FULL(64,65)                                       */
+  JVS[606] = -B[189];
+/* JVS(607) = Jac_FULL(64,66)                                       */
+  JVS[607] = -B[201];
+/* JVS(608) = Jac_FULL(64,67)                                       */
+  JVS[608] = -B[191];
+/* JVS(609) = Jac_FULL(64,68)                                       */
+  JVS[609] = -B[183];
+/* JVS(610) = Jac_FULL(64,69)                                       */
+  JVS[610] = -B[180];
+/* JVS(611) = Jac_FULL(64,70)                                       */
+  JVS[611] = -B[187]+0.5*B[283]+0.15*B[299];
+/* JVS(612) = Jac_FULL(64,71)                                       */
+  JVS[612] = -B[197];
+/* JVS(613) = Jac_FULL(64,72)                                       */
+  JVS[613] = -B[199];
+/* JVS(614) = Jac_FULL(64,73)                                       */
+  JVS[614] = 0.5*B[279]+0.289*B[295];
+/* JVS(615) = Jac_FULL(65,21)                                       */
+  JVS[615] = B[205];
+/* JVS(616) = Jac_FULL(65,25)                                       */
+  JVS[616] = 0.65*B[245];
+/* JVS(617) = Jac_FULL(65,29)                                       */
+  JVS[617] = 0.011*B[349];
+/* JVS(618) = Jac_FULL(65,41)                                       */
+  JVS[618] = 0;
+/* JVS(619) = Jac_FULL(65,43)                                       */
+  JVS[619] = 0.3*B[325];
+/* JVS(620) = Jac_FULL(65,46)                                       */
+  JVS[620] = 0.25*B[333];
+/* JVS(621) = Jac_FULL(65,48)                                       */
+  JVS[621] = 0;
+/* JVS(622) = Jac_FULL(65,50)                                       */
+  JVS[622] = 0.076*B[359];
+/* JVS(623) = Jac_FULL(65,52)                                       */
+  JVS[623] = 0.197*B[367]+0.03*B[369];
+/* JVS(624) = Jac_FULL(65,53)                                       */
+  JVS[624] = 0;
+/* JVS(625) = Jac_FULL(65,54)                                       */
+  JVS[625] = 0;
+/* JVS(626) = Jac_FULL(65,56)                                       */
+  JVS[626] = 0;
+/* JVS(627) = Jac_FULL(65,57)                                       */
+  JVS[627] = 0.3*B[326]+0.25*B[334];
+/* JVS(628) = Jac_FULL(65,58)                                       */
+  JVS[628] = 0;
+/* JVS(629) = Jac_FULL(65,59)                                       */
+  JVS[629] = 0;
+/* JVS(630) = Jac_FULL(65,60)                                       */
+  JVS[630] = 0;
+/* JVS(631) = Jac_FULL(65,61)                                       */
+  JVS[631] = 0.076*B[360]+0.197*B[368];
+/* JVS(632) = Jac_FULL(65,62)                                       */
+  JVS[632] = -B[80];
+/* JVS(633) = Jac_FULL(65,63)                                       */
+  JVS[633] = -B[110];
+/* JVS(634) = Jac_FULL(65,64)                                       */
+  JVS[634] = -B[188]+B[196];
+/* JVS(635) = Jac_FULL(65,65)                                       */
+  JVS[635] = -B[78]-B[81]-B[82]-2*B[84]-2*B[85]-B[92]-B[111]-B[128]
+            -B[146]-B[166]-B[189];
+/* JVS(636) = Jac_FULL(65,66)                                       */
+  JVS[636] = -B[167]+B[174];
+/* JVS(637) = Jac_FULL(65,67)                                       */
+  JVS[637] = -B[93];
+/* JVS(638) = Jac_FULL(65,68)                                       */
+  JVS[638] = -B[79]+B[122];
+/* JVS(639) = Jac_FULL(65,69)                                       */
+  JVS[639] = 0;
+/* JVS(640) = Jac_FULL(65,70)                                       */
+  JVS[640] = -B[83]+B[126]+0.03*B[370];
+/* JVS(641) = Jac_FULL(65,71)                                       */
+  JVS[641] = B[123]+B[127]-B[129]+2*B[136]+B[154]+B[175]+B[197];
+/* JVS(642) = Jac_FULL(65,72)                                       */
+  JVS[642] = -B[147]+B[155];
+/* JVS(643) = Jac_FULL(65,73)                                       */
+  JVS[643] = 0.65*B[246]+B[317]+0.011*B[350];
+/* JVS(644) = Jac_FULL(66,14)                                       */
+  JVS[644] = B[159];
+/* JVS(645) = Jac_FULL(66,37)                                       */
+  JVS[645] = B[273]+B[276];
+/* JVS(646) = Jac_FULL(66,52)                                       */
+  JVS[646] = 0;
+/* JVS(647) = Jac_FULL(66,57)                                       */
+  JVS[647] = 0;
+/* JVS(648) = Jac_FULL(66,61)                                       */
+  JVS[648] = 0;
+/* JVS(649) = Jac_FULL(66,62)                                       */
+  JVS[649] = -B[162];
+/* JVS(650) = Jac_FULL(66,63)                                       */
+  JVS[650] = -B[172];
+/* JVS(651) = Jac_FULL(66,64)                                       */
+  JVS[651] = -B[200];
+/* JVS(652) = Jac_FULL(66,65)                                       */
+  JVS[652] = -B[166];
+/* JVS(653) = Jac_FULL(66,66)                                       */
+  JVS[653] = -B[157]-B[160]-B[163]-B[164]-B[167]-B[168]-B[173]-B[174]
+            -B[176]-2*B[178]-B[201];
+/* JVS(654) = Jac_FULL(66,67)                                       */
+  JVS[654] = -B[169];
+/* JVS(655) = Jac_FULL(66,68)                                       */
+  JVS[655] = -B[161];
+/* JVS(656) = Jac_FULL(66,69)                                       */
+  JVS[656] = -B[158];
+/* JVS(657) = Jac_FULL(66,70)                                       */
+  JVS[657] = -B[165]+B[277];
+/* JVS(658) = Jac_FULL(66,71)                                       */
+  JVS[658] = -B[175];
+/* JVS(659) = Jac_FULL(66,72)                                       */
+  JVS[659] = -B[177];
+/* JVS(660) = Jac_FULL(66,73)                                       */
+  JVS[660] = B[274];
+/* JVS(661) = Jac_FULL(67,10)                                       */
+  JVS[661] = B[343];
+/* JVS(662) = Jac_FULL(67,19)                                       */
+  JVS[662] = 0.612*B[345];
+/* JVS(663) = Jac_FULL(67,20)                                       */
+  JVS[663] = 0.695*B[347];
+/* JVS(664) = Jac_FULL(67,22)                                       */
+  JVS[664] = 0.653*B[351];
+/* JVS(665) = Jac_FULL(67,23)                                       */
+  JVS[665] = 0.804*B[355];
+/* JVS(666) = Jac_FULL(67,29)                                       */
+  JVS[666] = 0.835*B[349];
+/* JVS(667) = Jac_FULL(67,30)                                       */
+  JVS[667] = 0.765*B[353];
+/* JVS(668) = Jac_FULL(67,31)                                       */
+  JVS[668] = 0;
+/* JVS(669) = Jac_FULL(67,32)                                       */
+  JVS[669] = 0;
+/* JVS(670) = Jac_FULL(67,33)                                       */
+  JVS[670] = 0.76*B[267];
+/* JVS(671) = Jac_FULL(67,34)                                       */
+  JVS[671] = B[307];
+/* JVS(672) = Jac_FULL(67,36)                                       */
+  JVS[672] = 0.34*B[248];
+/* JVS(673) = Jac_FULL(67,38)                                       */
+  JVS[673] = 0.76*B[263];
+/* JVS(674) = Jac_FULL(67,43)                                       */
+  JVS[674] = B[319]+B[323]+0.2*B[325];
+/* JVS(675) = Jac_FULL(67,45)                                       */
+  JVS[675] = 0;
+/* JVS(676) = Jac_FULL(67,46)                                       */
+  JVS[676] = 0.907*B[327]+0.066*B[329]+0.749*B[331];
+/* JVS(677) = Jac_FULL(67,48)                                       */
+  JVS[677] = 0.75*B[335]+0.031*B[337]+0.276*B[339];
+/* JVS(678) = Jac_FULL(67,49)                                       */
+  JVS[678] = 0.5*B[278]+0.1*B[280]+0.5*B[282];
+/* JVS(679) = Jac_FULL(67,50)                                       */
+  JVS[679] = 0.91*B[357]+0.022*B[359]+0.824*B[361];
+/* JVS(680) = Jac_FULL(67,51)                                       */
+  JVS[680] = 0.67*B[294]+0.048*B[296]+0.799*B[298];
+/* JVS(681) = Jac_FULL(67,52)                                       */
+  JVS[681] = 0.918*B[365]+0.033*B[367]+0.442*B[369]+0.012*B[371];
+/* JVS(682) = Jac_FULL(67,53)                                       */
+  JVS[682] = 0.3*B[287]+0.05*B[289];
+/* JVS(683) = Jac_FULL(67,56)                                       */
+  JVS[683] = 0.376*B[304];
+/* JVS(684) = Jac_FULL(67,57)                                       */
+  JVS[684] = 0.2*B[326]+0.012*B[372];
+/* JVS(685) = Jac_FULL(67,58)                                       */
+  JVS[685] = 0.034*B[232];
+/* JVS(686) = Jac_FULL(67,59)                                       */
+  JVS[686] = 0.37*B[240];
+/* JVS(687) = Jac_FULL(67,60)                                       */
+  JVS[687] = 0.473*B[301];
+/* JVS(688) = Jac_FULL(67,61)                                       */
+  JVS[688] = 0.1*B[281]+0.05*B[290]+0.048*B[297]+0.066*B[330]+0.031
+            *B[338]+0.022*B[360]+0.033*B[368];
+/* JVS(689) = Jac_FULL(67,62)                                       */
+  JVS[689] = -B[88];
+/* JVS(690) = Jac_FULL(67,63)                                       */
+  JVS[690] = -B[114];
+/* JVS(691) = Jac_FULL(67,64)                                       */
+  JVS[691] = -B[190]+B[198];
+/* JVS(692) = Jac_FULL(67,65)                                       */
+  JVS[692] = -B[92];
+/* JVS(693) = Jac_FULL(67,66)                                       */
+  JVS[693] = -B[168]+B[176];
+/* JVS(694) = Jac_FULL(67,67)                                       */
+  JVS[694] = -B[86]-B[89]-B[90]-B[93]-2*B[94]-B[115]-B[130]-B[148]
+            -B[169]-B[191];
+/* JVS(695) = Jac_FULL(67,68)                                       */
+  JVS[695] = -B[87]+B[140];
+/* JVS(696) = Jac_FULL(67,69)                                       */
+  JVS[696] = 0;
+/* JVS(697) = Jac_FULL(67,70)                                       */
+  JVS[697] = -B[91]+B[144]+0.5*B[283]+0.799*B[299]+B[324]+0.749*B[332]
+            +0.276*B[340]+0.824*B[362]+0.442*B[370];
+/* JVS(698) = Jac_FULL(67,71)                                       */
+  JVS[698] = -B[131]+B[154];
+/* JVS(699) = Jac_FULL(67,72)                                       */
+  JVS[699] = B[141]+B[145]-B[149]+B[155]+2*B[156]+B[177]+B[199];
+/* JVS(700) = Jac_FULL(67,73)                                       */
+  JVS[700] = 0.034*B[233]+0.37*B[241]+0.34*B[249]+0.76*B[264]+0.76
+            *B[268]+0.5*B[279]+0.3*B[288]+0.67*B[295]+0.473*B[302]
+            +0.376*B[305]+B[308]+B[320]+0.907*B[328]+0.75*B[336]+B[344]
+            +0.612*B[346]+0.695*B[348]+0.835*B[350]+0.653*B[352]+0.765
+            *B[354]+0.804*B[356]+0.91*B[358]+0.918*B[366];
+/* JVS(701) = Jac_FULL(68,18)                                       */
+  JVS[701] = 0;
+/* JVS(702) = Jac_FULL(68,26)                                       */
+  JVS[702] = -B[223];
+/* JVS(703) = Jac_FULL(68,47)                                       */
+  JVS[703] = -B[95];
+/* JVS(704) = Jac_FULL(68,48)                                       */
+  JVS[704] = 0;
+/* JVS(705) = Jac_FULL(68,50)                                       */
+  JVS[705] = 0;
+/* JVS(706) = Jac_FULL(68,52)                                       */
+  JVS[706] = 0;
+/* JVS(707) = Jac_FULL(68,53)                                       */
+  JVS[707] = 0;
+/* JVS(708) = Jac_FULL(68,55)                                       */
+  JVS[708] = 0;
+/* JVS(709) = Jac_FULL(68,56)                                       */
+  JVS[709] = 0;
+/* JVS(710) = Jac_FULL(68,57)                                       */
+  JVS[710] = -B[6]+B[9];
+/* JVS(711) = Jac_FULL(68,59)                                       */
+  JVS[711] = 0;
+/* JVS(712) = Jac_FULL(68,60)                                       */
+  JVS[712] = 0;
+/* JVS(713) = Jac_FULL(68,61)                                       */
+  JVS[713] = -B[13];
+/* JVS(714) = Jac_FULL(68,62)                                       */
+  JVS[714] = -B[53];
+/* JVS(715) = Jac_FULL(68,63)                                       */
+  JVS[715] = -B[106];
+/* JVS(716) = Jac_FULL(68,64)                                       */
+  JVS[716] = -B[182];
+/* JVS(717) = Jac_FULL(68,65)                                       */
+  JVS[717] = -B[78];
+/* JVS(718) = Jac_FULL(68,66)                                       */
+  JVS[718] = -B[160];
+/* JVS(719) = Jac_FULL(68,67)                                       */
+  JVS[719] = -B[86];
+/* JVS(720) = Jac_FULL(68,68)                                       */
+  JVS[720] = -B[7]-B[14]-B[17]-2*B[19]-B[36]-B[54]-B[79]-B[87]-B[96]
+            -B[107]-B[122]-B[140]-B[161]-B[183]-B[224];
+/* JVS(721) = Jac_FULL(68,69)                                       */
+  JVS[721] = B[10]+B[26];
+/* JVS(722) = Jac_FULL(68,70)                                       */
+  JVS[722] = -B[18]+B[27];
+/* JVS(723) = Jac_FULL(68,71)                                       */
+  JVS[723] = -B[123];
+/* JVS(724) = Jac_FULL(68,72)                                       */
+  JVS[724] = -B[141];
+/* JVS(725) = Jac_FULL(68,73)                                       */
+  JVS[725] = -B[37];
+/* JVS(726) = Jac_FULL(69,12)                                       */
+  JVS[726] = B[121];
+/* JVS(727) = Jac_FULL(69,13)                                       */
+  JVS[727] = B[139];
+/* JVS(728) = Jac_FULL(69,14)                                       */
+  JVS[728] = B[159];
+/* JVS(729) = Jac_FULL(69,15)                                       */
+  JVS[729] = B[181];
+/* JVS(730) = Jac_FULL(69,17)                                       */
+  JVS[730] = B[23];
+/* JVS(731) = Jac_FULL(69,18)                                       */
+  JVS[731] = B[40];
+/* JVS(732) = Jac_FULL(69,21)                                       */
+  JVS[732] = -B[203];
+/* JVS(733) = Jac_FULL(69,24)                                       */
+  JVS[733] = B[57]+B[59];
+/* JVS(734) = Jac_FULL(69,26)                                       */
+  JVS[734] = B[223];
+/* JVS(735) = Jac_FULL(69,27)                                       */
+  JVS[735] = -B[211];
+/* JVS(736) = Jac_FULL(69,35)                                       */
+  JVS[736] = 0;
+/* JVS(737) = Jac_FULL(69,42)                                       */
+  JVS[737] = 0;
+/* JVS(738) = Jac_FULL(69,44)                                       */
+  JVS[738] = 0;
+/* JVS(739) = Jac_FULL(69,45)                                       */
+  JVS[739] = -B[206];
+/* JVS(740) = Jac_FULL(69,46)                                       */
+  JVS[740] = 0.187*B[331];
+/* JVS(741) = Jac_FULL(69,47)                                       */
+  JVS[741] = B[95]+B[99];
+/* JVS(742) = Jac_FULL(69,48)                                       */
+  JVS[742] = 0.474*B[339];
+/* JVS(743) = Jac_FULL(69,49)                                       */
+  JVS[743] = 0;
+/* JVS(744) = Jac_FULL(69,50)                                       */
+  JVS[744] = 0;
+/* JVS(745) = Jac_FULL(69,51)                                       */
+  JVS[745] = 0;
+/* JVS(746) = Jac_FULL(69,52)                                       */
+  JVS[746] = 0.391*B[369];
+/* JVS(747) = Jac_FULL(69,53)                                       */
+  JVS[747] = 0;
+/* JVS(748) = Jac_FULL(69,54)                                       */
+  JVS[748] = 0;
+/* JVS(749) = Jac_FULL(69,55)                                       */
+  JVS[749] = 0;
+/* JVS(750) = Jac_FULL(69,56)                                       */
+  JVS[750] = 0.338*B[304];
+/* JVS(751) = Jac_FULL(69,57)                                       */
+  JVS[751] = B[6]-B[9]-B[11];
+/* JVS(752) = Jac_FULL(69,58)                                       */
+  JVS[752] = 0;
+/* JVS(753) = Jac_FULL(69,59)                                       */
+  JVS[753] = 0;
+/* JVS(754) = Jac_FULL(69,60)                                       */
+  JVS[754] = 0;
+/* JVS(755) = Jac_FULL(69,61)                                       */
+  JVS[755] = B[13]-B[15];
+/* JVS(756) = Jac_FULL(69,62)                                       */
+  JVS[756] = B[53]-B[55]+0.8*B[66];
+/* JVS(757) = Jac_FULL(69,63)                                       */
+  JVS[757] = B[112];
+/* JVS(758) = Jac_FULL(69,64)                                       */
+  JVS[758] = -B[179]+B[182]+B[186];
+/* JVS(759) = Jac_FULL(69,65)                                       */
+  JVS[759] = B[78]+B[82];
+/* JVS(760) = Jac_FULL(69,66)                                       */
+  JVS[760] = -B[157]+B[160]+B[164];
+/* JVS(761) = Jac_FULL(69,67)                                       */
+  JVS[761] = B[86]+B[90];
+/* JVS(762) = Jac_FULL(69,68)                                       */
+  JVS[762] = B[7]+B[14]+2*B[17]+2*B[19]+B[54]+B[79]+B[87]+B[96]+B[122]
+            +B[140]+B[161]+B[183]+B[224];
+/* JVS(763) = Jac_FULL(69,69)                                       */
+  JVS[763] = -B[10]-B[12]-B[16]-B[21]-B[42]-B[56]-B[119]-B[137]-B[158]
+           -B[180]-B[204]-B[207]-B[212];
+/* JVS(764) = Jac_FULL(69,70)                                       */
+  JVS[764] = 2*B[18]-B[22]+B[44]+0.8*B[67]+2*B[68]+B[83]+B[91]+B[100]
+           +B[113]+B[126]+B[144]+B[165]+B[187]+0.187*B[332]
+           +0.474*B[340]+0.391*B[370];
+/* JVS(765) = Jac_FULL(69,71)                                       */
+  JVS[765] = -B[120]+B[123]+B[127];
+/* JVS(766) = Jac_FULL(69,72)                                       */
+  JVS[766] = -B[138]+B[141]+B[145];
+/* JVS(767) = Jac_FULL(69,73)                                       */
+  JVS[767] = B[41]-B[43]+B[45]+B[60]+0.338*B[305];
+/* JVS(768) = Jac_FULL(70,17)                                       */
+  JVS[768] = B[23];
+/* JVS(769) = Jac_FULL(70,24)                                       */
+  JVS[769] = 0;
+/* JVS(770) = Jac_FULL(70,33)                                       */
+  JVS[770] = -B[269];
+/* JVS(771) = Jac_FULL(70,35)                                       */
+  JVS[771] = -B[271];
+/* JVS(772) = Jac_FULL(70,37)                                       */
+  JVS[772] = -B[276];
+/* JVS(773) = Jac_FULL(70,38)                                       */
+  JVS[773] = -B[265];
+/* JVS(774) = Jac_FULL(70,40)                                       */
+  JVS[774] = -B[260];
+/* JVS(775) = Jac_FULL(70,42)                                       */
+  JVS[775] = B[46];
+/* JVS(776) = Jac_FULL(70,43)                                       */
+  JVS[776] = -B[323];
+/* JVS(777) = Jac_FULL(70,44)                                       */
+  JVS[777] = -B[255];
+/* JVS(778) = Jac_FULL(70,45)                                       */
+  JVS[778] = 0;
+/* JVS(779) = Jac_FULL(70,46)                                       */
+  JVS[779] = -B[331];
+/* JVS(780) = Jac_FULL(70,47)                                       */
+  JVS[780] = -B[99];
+/* JVS(781) = Jac_FULL(70,48)                                       */
+  JVS[781] = -B[339];
+/* JVS(782) = Jac_FULL(70,49)                                       */
+  JVS[782] = -B[282];
+/* JVS(783) = Jac_FULL(70,50)                                       */
+  JVS[783] = -B[361];
+/* JVS(784) = Jac_FULL(70,51)                                       */
+  JVS[784] = -B[298];
+/* JVS(785) = Jac_FULL(70,52)                                       */
+  JVS[785] = -B[369];
+/* JVS(786) = Jac_FULL(70,53)                                       */
+  JVS[786] = 0;
+/* JVS(787) = Jac_FULL(70,54)                                       */
+  JVS[787] = -B[230];
+/* JVS(788) = Jac_FULL(70,55)                                       */
+  JVS[788] = -B[225];
+/* JVS(789) = Jac_FULL(70,56)                                       */
+  JVS[789] = 0;
+/* JVS(790) = Jac_FULL(70,57)                                       */
+  JVS[790] = B[11];
+/* JVS(791) = Jac_FULL(70,58)                                       */
+  JVS[791] = -B[235];
+/* JVS(792) = Jac_FULL(70,59)                                       */
+  JVS[792] = 0;
+/* JVS(793) = Jac_FULL(70,60)                                       */
+  JVS[793] = 0;
+/* JVS(794) = Jac_FULL(70,61)                                       */
+  JVS[794] = B[15];
+/* JVS(795) = Jac_FULL(70,62)                                       */
+  JVS[795] = -B[66];
+/* JVS(796) = Jac_FULL(70,63)                                       */
+  JVS[796] = -B[112];
+/* JVS(797) = Jac_FULL(70,64)                                       */
+  JVS[797] = -B[186];
+/* JVS(798) = Jac_FULL(70,65)                                       */
+  JVS[798] = -B[82];
+/* JVS(799) = Jac_FULL(70,66)                                       */
+  JVS[799] = -B[164];
+/* JVS(800) = Jac_FULL(70,67)                                       */
+  JVS[800] = -B[90];
+/* JVS(801) = Jac_FULL(70,68)                                       */
+  JVS[801] = -B[17];
+/* JVS(802) = Jac_FULL(70,69)                                       */
+  JVS[802] = B[12]+B[16]-B[21]-B[26];
+/* JVS(803) = Jac_FULL(70,70)                                       */
+  JVS[803] = -B[18]-B[22]-B[27]-B[44]-B[67]-2*B[68]-B[83]-B[91]-B[100]
+           -B[113]-B[126]-B[144]-B[165]-B[187]-B[226]-B[231]-B[236]
+           -B[256]-B[261]-B[266]-B[270]-B[272]-B[277]-B[283]-B[299]
+           -B[324]-B[332]-B[340]-B[362]-B[370];
+/* JVS(804) = Jac_FULL(70,71)                                       */
+  JVS[804] = -B[127];
+/* JVS(805) = Jac_FULL(70,72)                                       */
+  JVS[805] = -B[145];
+/* JVS(806) = Jac_FULL(70,73)                                       */
+  JVS[806] = -B[45]+B[47];
+/* JVS(807) = Jac_FULL(71,11)                                       */
+  JVS[807] = 0;
+/* JVS(808) = Jac_FULL(71,12)                                       */
+  JVS[808] = B[121];
+/* JVS(809) = Jac_FULL(71,23)                                       */
+  JVS[809] = 0;
+/* JVS(810) = Jac_FULL(71,29)                                       */
+  JVS[810] = 0.011*B[349];
+/* JVS(811) = Jac_FULL(71,31)                                       */
+  JVS[811] = B[311];
+/* JVS(812) = Jac_FULL(71,32)                                       */
+  JVS[812] = B[314];
+/* JVS(813) = Jac_FULL(71,40)                                       */
+  JVS[813] = B[258]+B[260];
+/* JVS(814) = Jac_FULL(71,41)                                       */
+  JVS[814] = B[237];
+/* JVS(815) = Jac_FULL(71,48)                                       */
+  JVS[815] = 0.123*B[337];
+/* JVS(816) = Jac_FULL(71,49)                                       */
+  JVS[816] = 0;
+/* JVS(817) = Jac_FULL(71,50)                                       */
+  JVS[817] = 0;
+/* JVS(818) = Jac_FULL(71,51)                                       */
+  JVS[818] = 0;
+/* JVS(819) = Jac_FULL(71,52)                                       */
+  JVS[819] = 0.137*B[367];
+/* JVS(820) = Jac_FULL(71,53)                                       */
+  JVS[820] = 0.675*B[287];
+/* JVS(821) = Jac_FULL(71,54)                                       */
+  JVS[821] = B[227]+B[230];
+/* JVS(822) = Jac_FULL(71,56)                                       */
+  JVS[822] = 0;
+/* JVS(823) = Jac_FULL(71,57)                                       */
+  JVS[823] = 0;
+/* JVS(824) = Jac_FULL(71,58)                                       */
+  JVS[824] = 0;
+/* JVS(825) = Jac_FULL(71,59)                                       */
+  JVS[825] = 0.492*B[240];
+/* JVS(826) = Jac_FULL(71,60)                                       */
+  JVS[826] = 0.029*B[301];
+/* JVS(827) = Jac_FULL(71,61)                                       */
+  JVS[827] = 0.123*B[338]+0.137*B[368];
+/* JVS(828) = Jac_FULL(71,62)                                       */
+  JVS[828] = -B[124];
+/* JVS(829) = Jac_FULL(71,63)                                       */
+  JVS[829] = -B[134];
+/* JVS(830) = Jac_FULL(71,64)                                       */
+  JVS[830] = B[182]+B[186]+B[198]+B[200]+2*B[202];
+/* JVS(831) = Jac_FULL(71,65)                                       */
+  JVS[831] = -B[128];
+/* JVS(832) = Jac_FULL(71,66)                                       */
+  JVS[832] = -B[174]+B[201];
+/* JVS(833) = Jac_FULL(71,67)                                       */
+  JVS[833] = -B[130];
+/* JVS(834) = Jac_FULL(71,68)                                       */
+  JVS[834] = -B[122]+B[183];
+/* JVS(835) = Jac_FULL(71,69)                                       */
+  JVS[835] = -B[119];
+/* JVS(836) = Jac_FULL(71,70)                                       */
+  JVS[836] = -B[126]+B[187]+B[231]+B[261];
+/* JVS(837) = Jac_FULL(71,71)                                       */
+  JVS[837] = -B[120]-B[123]-B[125]-B[127]-B[129]-B[131]-B[135]-2*B[136]
+            -B[154]-B[175];
+/* JVS(838) = Jac_FULL(71,72)                                       */
+  JVS[838] = -B[155]+B[199];
+/* JVS(839) = Jac_FULL(71,73)                                       */
+  JVS[839] = B[228]+B[238]+0.492*B[241]+B[259]+0.675*B[288]+0.029
+            *B[302]+B[312]+B[315]+0.011*B[350];
+/* JVS(840) = Jac_FULL(72,13)                                       */
+  JVS[840] = B[139];
+/* JVS(841) = Jac_FULL(72,44)                                       */
+  JVS[841] = 0.37*B[253]+0.37*B[255];
+/* JVS(842) = Jac_FULL(72,45)                                       */
+  JVS[842] = 0;
+/* JVS(843) = Jac_FULL(72,48)                                       */
+  JVS[843] = 0.201*B[337];
+/* JVS(844) = Jac_FULL(72,49)                                       */
+  JVS[844] = 0.1*B[280];
+/* JVS(845) = Jac_FULL(72,51)                                       */
+  JVS[845] = 0.048*B[296];
+/* JVS(846) = Jac_FULL(72,52)                                       */
+  JVS[846] = 0.006*B[367];
+/* JVS(847) = Jac_FULL(72,53)                                       */
+  JVS[847] = 0.05*B[289];
+/* JVS(848) = Jac_FULL(72,57)                                       */
+  JVS[848] = 0;
+/* JVS(849) = Jac_FULL(72,58)                                       */
+  JVS[849] = 0.965*B[232]+B[235];
+/* JVS(850) = Jac_FULL(72,59)                                       */
+  JVS[850] = 0.096*B[240];
+/* JVS(851) = Jac_FULL(72,60)                                       */
+  JVS[851] = 0.049*B[301];
+/* JVS(852) = Jac_FULL(72,61)                                       */
+  JVS[852] = 0.1*B[281]+0.05*B[290]+0.048*B[297]+0.201*B[338]+0.006
+            *B[368];
+/* JVS(853) = Jac_FULL(72,62)                                       */
+  JVS[853] = -B[142];
+/* JVS(854) = Jac_FULL(72,63)                                       */
+  JVS[854] = -B[152];
+/* JVS(855) = Jac_FULL(72,64)                                       */
+  JVS[855] = -B[198];
+/* JVS(856) = Jac_FULL(72,65)                                       */
+  JVS[856] = -B[146];
+/* JVS(857) = Jac_FULL(72,66)                                       */
+  JVS[857] = -B[176];
+/* JVS(858) = Jac_FULL(72,67)                                       */
+  JVS[858] = -B[148];
+/* JVS(859) = Jac_FULL(72,68)                                       */
+  JVS[859] = -B[140];
+/* JVS(860) = Jac_FULL(72,69)                                       */
+  JVS[860] = -B[137];
+/* JVS(861) = Jac_FULL(72,70)                                       */
+  JVS[861] = -B[144]+B[236]+0.37*B[256];
+/* JVS(862) = Jac_FULL(72,71)                                       */
+  JVS[862] = -B[154];
+/* JVS(863) = Jac_FULL(72,72)                                       */
+  JVS[863] = -B[138]-B[141]-B[143]-B[145]-B[147]-B[149]-B[153]-B[155]-2
+            *B[156]-B[177]-B[199];
+/* JVS(864) = Jac_FULL(72,73)                                       */
+  JVS[864] = 0.965*B[233]+0.096*B[241]+0.37*B[254]+0.049*B[302];
+/* JVS(865) = Jac_FULL(73,8)                                        */
+  JVS[865] = -B[74];
+/* JVS(866) = Jac_FULL(73,9)                                        */
+  JVS[866] = 2*B[32];
+/* JVS(867) = Jac_FULL(73,10)                                       */
+  JVS[867] = -B[343];
+/* JVS(868) = Jac_FULL(73,16)                                       */
+  JVS[868] = -B[70];
+/* JVS(869) = Jac_FULL(73,18)                                       */
+  JVS[869] = -B[40];
+/* JVS(870) = Jac_FULL(73,19)                                       */
+  JVS[870] = -0.754*B[345];
+/* JVS(871) = Jac_FULL(73,20)                                       */
+  JVS[871] = -B[347];
+/* JVS(872) = Jac_FULL(73,22)                                       */
+  JVS[872] = -B[351];
+/* JVS(873) = Jac_FULL(73,23)                                       */
+  JVS[873] = -B[355];
+/* JVS(874) = Jac_FULL(73,24)                                       */
+  JVS[874] = -B[59];
+/* JVS(875) = Jac_FULL(73,25)                                       */
+  JVS[875] = -0.65*B[245];
+/* JVS(876) = Jac_FULL(73,28)                                       */
+  JVS[876] = -B[243];
+/* JVS(877) = Jac_FULL(73,29)                                       */
+  JVS[877] = -B[349];
+/* JVS(878) = Jac_FULL(73,30)                                       */
+  JVS[878] = -B[353];
+/* JVS(879) = Jac_FULL(73,31)                                       */
+  JVS[879] = -B[311];
+/* JVS(880) = Jac_FULL(73,32)                                       */
+  JVS[880] = -B[314];
+/* JVS(881) = Jac_FULL(73,33)                                       */
+  JVS[881] = -B[267];
+/* JVS(882) = Jac_FULL(73,34)                                       */
+  JVS[882] = -B[307]+0.5*B[309];
+/* JVS(883) = Jac_FULL(73,36)                                       */
+  JVS[883] = -0.34*B[248];
+/* JVS(884) = Jac_FULL(73,37)                                       */
+  JVS[884] = -B[273];
+/* JVS(885) = Jac_FULL(73,38)                                       */
+  JVS[885] = -B[263];
+/* JVS(886) = Jac_FULL(73,39)                                       */
+  JVS[886] = -B[49];
+/* JVS(887) = Jac_FULL(73,40)                                       */
+  JVS[887] = -B[258];
+/* JVS(888) = Jac_FULL(73,41)                                       */
+  JVS[888] = -B[237];
+/* JVS(889) = Jac_FULL(73,42)                                       */
+  JVS[889] = -B[46];
+/* JVS(890) = Jac_FULL(73,43)                                       */
+  JVS[890] = -B[319]+0.12*B[321];
+/* JVS(891) = Jac_FULL(73,44)                                       */
+  JVS[891] = -B[253];
+/* JVS(892) = Jac_FULL(73,45)                                       */
+  JVS[892] = 0;
+/* JVS(893) = Jac_FULL(73,46)                                       */
+  JVS[893] = -B[327]+0.266*B[329];
+/* JVS(894) = Jac_FULL(73,48)                                       */
+  JVS[894] = -B[335]+0.567*B[337];
+/* JVS(895) = Jac_FULL(73,49)                                       */
+  JVS[895] = -B[278]+0.208*B[280];
+/* JVS(896) = Jac_FULL(73,50)                                       */
+  JVS[896] = -B[357]+0.155*B[359];
+/* JVS(897) = Jac_FULL(73,51)                                       */
+  JVS[897] = -B[294]+0.285*B[296];
+/* JVS(898) = Jac_FULL(73,52)                                       */
+  JVS[898] = -B[365]+0.378*B[367];
+/* JVS(899) = Jac_FULL(73,53)                                       */
+  JVS[899] = -B[287]+0.164*B[289];
+/* JVS(900) = Jac_FULL(73,54)                                       */
+  JVS[900] = -B[227];
+/* JVS(901) = Jac_FULL(73,55)                                       */
+  JVS[901] = -B[218];
+/* JVS(902) = Jac_FULL(73,56)                                       */
+  JVS[902] = -B[304];
+/* JVS(903) = Jac_FULL(73,57)                                       */
+  JVS[903] = 0;
+/* JVS(904) = Jac_FULL(73,58)                                       */
+  JVS[904] = -B[232];
+/* JVS(905) = Jac_FULL(73,59)                                       */
+  JVS[905] = -B[240];
+/* JVS(906) = Jac_FULL(73,60)                                       */
+  JVS[906] = -B[301];
+/* JVS(907) = Jac_FULL(73,61)                                       */
+  JVS[907] = -B[51]+B[61]+0.208*B[281]+0.164*B[290]+0.285*B[297]+0.5
+            *B[310]+0.12*B[322]+0.266*B[330]+0.567*B[338]+0.155*B[360]
+            +0.378*B[368];
+/* JVS(908) = Jac_FULL(73,62)                                       */
+  JVS[908] = B[53]+B[62]+0.8*B[66]-B[72];
+/* JVS(909) = Jac_FULL(73,63)                                       */
+  JVS[909] = 0;
+/* JVS(910) = Jac_FULL(73,64)                                       */
+  JVS[910] = 0;
+/* JVS(911) = Jac_FULL(73,65)                                       */
+  JVS[911] = 0;
+/* JVS(912) = Jac_FULL(73,66)                                       */
+  JVS[912] = 0;
+/* JVS(913) = Jac_FULL(73,67)                                       */
+  JVS[913] = 0;
+/* JVS(914) = Jac_FULL(73,68)                                       */
+  JVS[914] = -B[36]+B[54];
+/* JVS(915) = Jac_FULL(73,69)                                       */
+  JVS[915] = -B[42];
+/* JVS(916) = Jac_FULL(73,70)                                       */
+  JVS[916] = -B[44]+0.8*B[67];
+/* JVS(917) = Jac_FULL(73,71)                                       */
+  JVS[917] = 0;
+/* JVS(918) = Jac_FULL(73,72)                                       */
+  JVS[918] = 0;
+/* JVS(919) = Jac_FULL(73,73)                                       */
+  JVS[919] = -B[37]-B[41]-B[43]-B[45]-B[47]-B[50]-B[52]-B[60]-B[71]
+            -B[73]-B[75]-B[76]-B[219]-B[228]-B[233]-B[238]-B[241]
+            -B[244]-0.65*B[246]-0.34*B[249]-B[254]-B[259]-B[264]-B[268]
+            -B[274]-B[279]-B[288]-B[295]-B[302]-B[305]-B[308]-B[312]
+            -B[315]-B[317]-B[320]-B[328]-B[336]-B[344]-0.754*B[346]
+            -B[348]-B[350]-B[352]-B[354]-B[356]-B[358]-B[366];
+}
+
+/* End of Jac_SP_Dark function                                      */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#endif
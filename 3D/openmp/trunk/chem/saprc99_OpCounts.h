@@ -0,0 +1,20 @@
+/*
+ *  saprc99_OpCounts.h
+ *
+ *  Floating point operations per call of the unrolled kernels.
+ *  Generated by gen_opcounts.sh; do not edit.
+ *
+ */
+
+#ifndef __SAPRC99_OPCOUNTS_H__
+#define __SAPRC99_OPCOUNTS_H__
+
+#define FUN_FLOPS          1783
+#define FUN_DARK_FLOPS     1570
+#define FUN_PHOTO_FLOPS    174
+#define JAC_SP_FLOPS       2177
+#define JAC_SP_DARK_FLOPS  2028
+#define JAC_SP_VEC_FLOPS   1604
+#define KPPSOLVE_FLOPS     1766
+
+#endif
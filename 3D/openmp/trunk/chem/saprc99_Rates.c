@@ -139,6 +139,38 @@ const double PI = 3.14159265358979;
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
 
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/* SUN_Rate - time derivative of SUN (per second) at TIME           */
+/*   Arguments :                                                    */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+double SUN_Rate()
+{
+double SunRise, SunSet;
+double Thour, Tlocal, Ttmp, dTtmp; 
+const double PI = 3.14159265358979;  
+
+  SunRise = 4.5;
+  SunSet  = 19.5;
+  Thour = TIME/3600.0;
+  Tlocal = Thour - ((int)Thour/24)*24;
+
+  if ( (Tlocal >= SunRise) && (Tlocal <= SunSet) ) {
+    Ttmp = (2.0*Tlocal-SunRise-SunSet)/(SunSet-SunRise);
+    if (Ttmp > 0) { dTtmp =  2.0*Ttmp; Ttmp =  Ttmp*Ttmp; }
+             else { dTtmp = -2.0*Ttmp; Ttmp = -Ttmp*Ttmp; }
+    dTtmp *= 2.0/(SunSet-SunRise);
+    return -PI*sin(PI*Ttmp)*dTtmp/2.0/3600.0;
+  } else {
+    return 0.0;
+  }
+}
+/* End of SUN_Rate function                                         */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 /*                                                                  */
 /* Update_RCONST - function to update rate constants                */
@@ -0,0 +1,145 @@
+/*
+ *  chemcapture.c
+ *
+ *  Samples of the cells the chemistry integrates.
+ *
+ *  With -capture, one cell in CAPTURE_STRIDE is written each
+ *  chemistry call, up to CAPTURE_MAX cells, to
+ *  OUTPUT_DIR/CHEM_<RUN_ID>_<threads>.bin: a capture_header_t and
+ *  then one capture_record_t per cell, in the byte order of the
+ *  machine that wrote it.  The cells sampled move by one each call,
+ *  so a long run samples every part of the grid at every time of day.
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chemcapture.h"
+#include "saprc99_Global.h"
+
+int capture_on = 0;
+
+static FILE* capture_fptr = NULL;
+static char capture_fname[255];
+static int32_t capture_count = 0;
+static capture_header_t capture_hdr;
+
+/**
+ * Opens the capture file and starts capturing
+ */
+void capture_open(int nprocs, int method, int mixed_lu)
+{
+    sprintf(capture_fname, "%s/CHEM_%03d_%02d.bin", OUTPUT_DIR, RUN_ID, nprocs);
+
+    if((capture_fptr = fopen(capture_fname, "wb")) == NULL)
+    {
+        fprintf(stderr, "Couldn't open file \"%s\" for writing.\n", capture_fname);
+        return;
+    }
+
+    memset(&capture_hdr, 0, sizeof(capture_hdr));
+    strcpy(capture_hdr.magic, CAPTURE_MAGIC);
+    capture_hdr.nspec = NSPEC;
+    capture_hdr.nvar = NVAR;
+    capture_hdr.method = method;
+    capture_hdr.mixed_lu = mixed_lu;
+    capture_hdr.warm_start = CHEM_WARM_START;
+
+    /* Rewritten with the count and tolerances when closed */
+    fwrite(&capture_hdr, sizeof(capture_hdr), 1, capture_fptr);
+
+    capture_count = 0;
+    capture_on = 1;
+}
+
+/**
+ * Appends a record.  Thread safe.
+ */
+void capture_write(capture_record_t* r)
+{
+    #pragma omp critical (capture)
+    {
+        if(capture_on && capture_count < CAPTURE_MAX)
+        {
+            fwrite(r, sizeof(capture_record_t), 1, capture_fptr);
+            ++capture_count;
+        }
+    }
+}
+
+/**
+ * Completes the header and closes the capture file
+ */
+void capture_close()
+{
+    if(!capture_on)
+        return;
+    capture_on = 0;
+
+    capture_hdr.count = capture_count;
+    capture_hdr.stepmin = STEPMIN;
+    capture_hdr.atol = ATOL[0];
+    capture_hdr.rtol = RTOL[0];
+
+    fseek(capture_fptr, 0, SEEK_SET);
+    fwrite(&capture_hdr, sizeof(capture_hdr), 1, capture_fptr);
+    fclose(capture_fptr);
+
+    printf("Captured %d chemistry cells to file: %s\n", capture_count, capture_fname);
+}
+
+/**
+ * Reads a capture file.  Returns the records, or NULL
+ * if the file can't be read or was written with a
+ * different mechanism.
+ */
+capture_record_t* capture_read(char* fname, capture_header_t* h)
+{
+    FILE* fptr;
+    capture_record_t* r;
+
+    if((fptr = fopen(fname, "rb")) == NULL)
+    {
+        fprintf(stderr, "Couldn't open file \"%s\" for reading.\n", fname);
+        return NULL;
+    }
+
+    if(fread(h, sizeof(capture_header_t), 1, fptr) != 1 || strcmp(h->magic, CAPTURE_MAGIC))
+    {
+        fprintf(stderr, "%s is not a chemistry capture file.\n", fname);
+        fclose(fptr);
+        return NULL;
+    }
+
+    if(h->nspec != NSPEC || h->nvar != NVAR)
+    {
+        fprintf(stderr, "%s has %d species (%d variable), this build has %d (%d).\n",
+                fname, h->nspec, h->nvar, NSPEC, NVAR);
+        fclose(fptr);
+        return NULL;
+    }
+
+    r = (capture_record_t*)malloc(sizeof(capture_record_t)*(h->count > 0 ? h->count : 1));
+    if(!r)
+    {
+        fprintf(stderr, "Couldn't allocate %d capture records.\n", h->count);
+        fclose(fptr);
+        return NULL;
+    }
+
+    if(fread(r, sizeof(capture_record_t), h->count, fptr) != (size_t)h->count)
+    {
+        fprintf(stderr, "%s is truncated.\n", fname);
+        free(r);
+        fclose(fptr);
+        return NULL;
+    }
+
+    fclose(fptr);
+    return r;
+}
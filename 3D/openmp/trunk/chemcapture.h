@@ -0,0 +1,102 @@
+/*
+ *  chemcapture.h
+ *
+ *  Samples of the cells the chemistry integrates, with the state
+ *  each integration started from and the state it reached, so the
+ *  integrator can be replayed on real cells outside the model
+ *  (bench_replay).
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#ifndef __CHEMCAPTURE_H__
+#define __CHEMCAPTURE_H__
+
+/**************************************************
+ * Includes                                       *
+ **************************************************/
+
+#include <stdint.h>
+
+#include "params.h"
+
+/**************************************************
+ * Macros                                         *
+ **************************************************/
+
+/* One cell in CAPTURE_STRIDE is captured each chemistry call.
+ * The sampled cells move by one each call. */
+#define CAPTURE_STRIDE 61
+
+/* Most cells captured in one run */
+#define CAPTURE_MAX    (1 << 18)
+
+/* First bytes of a capture file */
+#define CAPTURE_MAGIC  "FGCHEM1"
+
+/**************************************************
+ * Data types                                     *
+ **************************************************/
+
+/* Capture file header.  The records follow it. */
+typedef struct capture_header
+{
+    char magic[8];
+    int32_t nspec;
+    int32_t nvar;
+    int32_t count;          /* Records in the file */
+    int32_t method;         /* Rosenbrock method (IPAR[3]) */
+    int32_t mixed_lu;       /* IPAR[4] */
+    int32_t warm_start;     /* CHEM_WARM_START */
+    double stepmin;
+    double atol;            /* Scalar tolerances */
+    double rtol;
+} capture_header_t;
+
+/* One integration of one cell */
+typedef struct capture_record
+{
+    int32_t x, y, z;
+    int32_t call;           /* Chemistry call, from 1 */
+    double time;            /* Start of the integration (TIME) */
+    double dt;              /* Length of the integration (DT) */
+    double temp;            /* TEMP */
+    double hstart;          /* Starting step (RPAR[2]) */
+    int32_t nstp;           /* Steps taken (IPAR[12]) */
+    int32_t nrej;           /* Steps rejected (IPAR[14]) */
+    double in[NSPEC];       /* Concentrations before */
+    double out[NSPEC];      /* and after */
+} capture_record_t;
+
+/**************************************************
+ * Globals                                        *
+ **************************************************/
+
+/* Nonzero while capturing */
+extern int capture_on;
+
+/**************************************************
+ * Function Prototypes                            *
+ **************************************************/
+
+void capture_open(int nprocs, int method, int mixed_lu);
+
+void capture_write(capture_record_t* r);
+
+void capture_close();
+
+capture_record_t* capture_read(char* fname, capture_header_t* h);
+
+/**************************************************
+ * Inline fuctions                                *
+ **************************************************/
+
+/* TRUE if cell (x, y, z) is captured at chemistry call */
+static inline int capture_cell(int32_t x, int32_t y, int32_t z, uint32_t call)
+{
+    return capture_on && ((x + NX*(y + NY*z)) + call) % CAPTURE_STRIDE == 0;
+}
+
+#endif
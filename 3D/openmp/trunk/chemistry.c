@@ -8,95 +8,406 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "chemistry.h"
 #include "saprc99_Global.h"
+#include "transpose.h"
+#include "chemsched.h"
+#include "chemcapture.h"
 
 int Rosenbrock( double Y[], double Tstart, double Tend,
                double AbsTol[],  double RelTol[],
                double RPAR[], int IPAR[]);
 
+/**
+ * Resets the integrator statistics and per-cell step sizes
+ */
+void chem_init(fixedgrid_t* G)
+{
+    int k;
+#if DO_CHEMISTRY == 1
+    int32_t x, y, z;
+#endif
+    
+    for(k=0; k<11; k++)
+    {
+        G->chem_stats[k] = 0;
+    }
+    
+#if DO_CHEMISTRY == 1
+    /* No step accepted yet: first integration starts from STEPMIN
+     * and every cell is predicted to cost the same */
+    for(z=0; z<NZ; z++)
+        for(y=0; y<NY; y++)
+            for(x=0; x<NX; x++)
+            {
+                G->hstart(x, y, z) = 0.0f;
+                G->cost(x, y, z) = 0;
+#if CHEM_COST_MAP == 1
+                G->cost_nstp(x, y, z) = 0;
+                G->cost_nrej(x, y, z) = 0;
+                G->cost_usec(x, y, z) = 0;
+#endif
+            }
+#endif
+}
+
+/**
+ * Applies saprc99 chemical mechanism to one row of cells.
+ * Thread safe: the KPP globals are threadprivate.
+ */
+void saprc99_chem_row(fixedgrid_t* G, int32_t y, int32_t z)
+{
+#if DO_CHEMISTRY == 1
+    int32_t x, x0, n;
+    int i, k;
+    
+    /* Integration method statistics for this row */
+    int stats[11];
+    
+    /* Integration method parameters */
+    double RPAR[20];
+    int    IPAR[21];
+    int    IERR;
+        
+    /* Chemistry buffer: CHEM_BLOCK cells, cell-major */
+    double blk[CHEM_BLOCK*NSPEC];
+    double *buff;
+    
+    /* Captured cell */
+    capture_record_t rec;
+    bool captured;
+    
+#if CHEM_COST_MAP == 1
+    /* Start of the cell's integration (sec) */
+    double tcell;
+#endif
+    
+    /* Initialize method globals */
+    TIME = G->time;
+    DT = G->chem_rate.dt;
+    
+    /* Initalize parameters */
+    for(i=0; i<20; i++)
+    {
+        IPAR[i] = 0;
+        RPAR[i] = 0.0;
+    }
+    IPAR[0] = 0;        /* non-autonomous */
+    IPAR[1] = 1;        /* scalar tolerances */
+    RPAR[2] = STEPMIN;  /* starting step */
+    IPAR[3] = 5;        /* method selection: Rodas4 */
+    IPAR[4] = CHEM_MIXED_LU; /* single precision LU with refinement */
+    
+    for(k=0; k<11; k++)
+    {
+        stats[k] = 0;
+    }
+    
+    for(x0=0; x0<NX; x0+=CHEM_BLOCK)
+    {
+        n = NX - x0 < CHEM_BLOCK ? NX - x0 : CHEM_BLOCK;
+        
+        /* Transpose a block of cells in */
+        gather_cells(G, x0, n, y, z, blk);
+        
+        for(x=x0; x<x0+n; x++)
+        {
+            buff = &blk[(x-x0)*NSPEC];
+            
+            /* Point method at current data */
+            C   = &buff[0];
+            VAR = &buff[0];
+            FIX = &buff[NFIXST];
+            TEMP = G->temp(x, y, z);
+            
+            /* Start from the last step accepted in this cell */
+#if CHEM_WARM_START == 1
+            RPAR[2] = G->hstart(x, y, z) > 0.0f ? G->hstart(x, y, z) : STEPMIN;
+#endif
+            
+            /* Reset statistics for each integration */
+            for(k=0; k<11; k++)
+            {
+                IPAR[10+k] = 0;
+            }
+            
+            /* Sample the cell's starting state */
+            captured = capture_cell(x, y, z, G->chem_rate.calls);
+            if(captured)
+            {
+                rec.x = x;
+                rec.y = y;
+                rec.z = z;
+                rec.call = G->chem_rate.calls;
+                rec.time = TIME;
+                rec.dt = DT;
+                rec.temp = TEMP;
+                rec.hstart = RPAR[2];
+                memcpy(rec.in, buff, sizeof(rec.in));
+            }
+            
+            /* Integrate */
+#if CHEM_COST_MAP == 1
+            tcell = elapsed_time();
+#endif
+            IERR = Rosenbrock(VAR, TIME, TIME+DT, ATOL, RTOL, RPAR, IPAR);
+#if CHEM_COST_MAP == 1
+            G->cost_usec(x, y, z) += (uint32_t)((elapsed_time() - tcell)*1.0e6 + 0.5);
+            G->cost_nstp(x, y, z) += IPAR[12];
+            G->cost_nrej(x, y, z) += IPAR[14];
+#endif
+            
+            if(IERR < 0)
+            {
+                printf("\n Rosenbrock: Unsucessful step at T=%g: IERR=%d\n", TIME, IERR);
+            }            
+            
+            for(k=0; k<11; k++)
+            {
+                stats[k] += IPAR[10+k];
+            }
+            
+            if(captured)
+            {
+                rec.nstp = IPAR[12];
+                rec.nrej = IPAR[14];
+                memcpy(rec.out, buff, sizeof(rec.out));
+                capture_write(&rec);
+            }
+            
+            /* Predicted cost of this cell at the next call */
+            G->cost(x, y, z) = IPAR[12] < UINT16_MAX ? IPAR[12] : UINT16_MAX;
+            
+            G->hstart(x, y, z) = (float)RPAR[11];
+        }
+        
+        /* Transpose the block back out */
+        scatter_cells(G, x0, n, y, z, blk);
+    }
+    
+    /* Record final statistics */
+    for(k=0; k<11; k++)
+    {
+        #pragma omp atomic
+        G->chem_stats[k] += stats[k];
+    }
+#endif
+}
+
 /**
  * Applies saprc99 chemical mechanism to all chemical species
  */
 void saprc99_chem(fixedgrid_t* G)
 {
-//#if DO_CHEMISTRY == 1
-//    int i, j, k;
-//    
-//    /* Integration method statistics.
-//     * (Used to detect limit violation.) */
-//    static int stats[8];
-//    
-//    /* Integration method parameters */
-//    double RPAR[20];
-//    int    IPAR[20];
-//    int    IERR;
-//        
-//    /* Chemistry buffer */
-//    double buff[NSPEC];
-//    
-//    /* Initialize method globals */
-//    TIME = G->time;
-//    DT = G->dt;
-//    
-//    /* Initalize parameters */
-//    for(i=0; i<20; i++)
-//    {
-//        IPAR[i] = 0;
-//        RPAR[i] = 0.0;
-//    }
-//    IPAR[0] = 0;        /* non-autonomous */
-//    IPAR[1] = 1;        /* scalar tolerances */
-//    RPAR[2] = STEPMIN;  /* starting step */
-//    IPAR[3] = 5;        /* method selection: Rodas4 */
-//    
-//    timer_start(&G->metrics.chem);
-//    for(i=0; i<NY; i++)
-//    {
-//        printf("Chem on row %d of %d...\n", i, NY);
-//        for(j=0; j<NX; j++)
-//        {
-//            for(k=0; k<NSPEC; k++)
-//            {
-//                buff[k] = G->conc[k][i][j];
-//            }
-//            
-//            /* Point method at current data */
-//            C   = &buff[0];
-//            VAR = &buff[0];
-//            FIX = &buff[NFIXST];
-//            
-//            /* Reset statistics for each integration */
-//            for(k=0; k<8; k++)
-//            {
-//                IPAR[10+k] = stats[k];
-//            }
-//            
-//            /* Integrate */
-//            IERR = Rosenbrock(VAR, TIME, TIME+DT, ATOL, RTOL, RPAR, IPAR);
-//            
-//            if(IERR < 0)
-//            {
-//                printf("\n Rosenbrock: Unsucessful step at T=%g: IERR=%d\n", TIME, IERR);
-//            }            
-//            
-//            for(k=0; k<NSPEC; k++)
-//            {
-//                G->conc[k][i][j] = buff[k];
-//            }
-//        }
-//    }
-//    
-//    /* Record final statistics */
-//    for(k=0; k<8; k++)
-//    {
-//        stats[k] = IPAR[10+k];
-//    }
-//    
-//    /* Record last step for next method invocation */
-//    STEPMIN = RPAR[11];
-//    
-//    timer_stop(&G->metrics.chem);
-//#endif
+#if DO_CHEMISTRY == 1
+    timer_start(&G->metrics, "Chemistry");
+    
+    chem_sched_run(G);
+    
+    timer_stop(&G->metrics, "Chemistry");
+#endif
+}
+
+/**
+ * Displays the integrator statistics
+ */
+void print_chem_stats(fixedgrid_t* G)
+{
+#if DO_CHEMISTRY == 1
+    printf("Chemistry: Nfun %llu  Njac %llu  Nstp %llu  Nacc %llu  Nrej %llu  Ndec %llu  Nsol %llu  Nsng %llu\n",
+           (unsigned long long)G->chem_stats[0], (unsigned long long)G->chem_stats[1],
+           (unsigned long long)G->chem_stats[2], (unsigned long long)G->chem_stats[3],
+           (unsigned long long)G->chem_stats[4], (unsigned long long)G->chem_stats[5],
+           (unsigned long long)G->chem_stats[6], (unsigned long long)G->chem_stats[7]);
+    printf("Chemistry: Nfun dark %llu  Njac dark %llu  Nphoto %llu\n",
+           (unsigned long long)G->chem_stats[8], (unsigned long long)G->chem_stats[9],
+           (unsigned long long)G->chem_stats[10]);
+#endif
+}
+
+#if DO_CHEMISTRY == 1 && CHEM_COST_MAP == 1
+
+/* Buckets of the cost histogram: 1, 2, 3-4, 5-8, ... steps per call */
+#define COST_BUCKETS 8
+
+/* Hottest cells listed */
+#define COST_HOT 5
+
+/* Chemistry cost of the cells, summarized */
+typedef struct chem_cost
+{
+    /* Cells, steps, rejected steps and time (usec) by
+     * steps per chemistry call */
+    uint64_t cells[COST_BUCKETS];
+    uint64_t nstp[COST_BUCKETS];
+    uint64_t nrej[COST_BUCKETS];
+    uint64_t usec[COST_BUCKETS];
+    
+    /* Totals */
+    uint64_t total_nstp;
+    uint64_t total_nrej;
+    uint64_t total_usec;
+    
+    /* Share of the time spent in the costliest 1% and 10% of cells */
+    double top1;
+    double top10;
+    
+    /* Costliest cells, as z*NY*NX + y*NX + x */
+    int32_t hot[COST_HOT];
+} chem_cost_t;
+
+static int compare_usec_desc(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+    return x > y ? -1 : x < y;
 }
 
+/**
+ * Returns the label of a cost histogram bucket
+ */
+static void cost_bucket_label(int b, char* label)
+{
+    if(b == 0)
+        sprintf(label, "1");
+    else if(b == 1)
+        sprintf(label, "2");
+    else if(b == COST_BUCKETS-1)
+        sprintf(label, "> %d", 1 << (b-1));
+    else
+        sprintf(label, "%d-%d", (1 << (b-1)) + 1, 1 << b);
+}
+
+/**
+ * Summarizes the per-cell chemistry cost
+ */
+static void chem_cost_summary(fixedgrid_t* G, chem_cost_t* c)
+{
+    const int32_t ncells = NX*NY*NZ;
+    int32_t x, y, z, i, j, b, k;
+    uint32_t calls = G->chem_rate.calls > 0 ? G->chem_rate.calls : 1;
+    uint32_t* cu = &G->cost_usec(0, 0, 0);
+    uint32_t* usec;
+    uint64_t sum;
+    
+    memset(c, 0, sizeof(chem_cost_t));
+    for(i=0; i<COST_HOT; i++)
+        c->hot[i] = -1;
+    
+    usec = (uint32_t*)malloc(sizeof(uint32_t)*ncells);
+    
+    for(z=0; z<NZ; z++)
+        for(y=0; y<NY; y++)
+            for(x=0; x<NX; x++)
+            {
+                /* Bucket by steps per call, rounded up */
+                k = (G->cost_nstp(x, y, z) + calls - 1) / calls;
+                for(b=0; b<COST_BUCKETS-1 && k > (1 << b); b++);
+                
+                c->cells[b] += 1;
+                c->nstp[b] += G->cost_nstp(x, y, z);
+                c->nrej[b] += G->cost_nrej(x, y, z);
+                c->usec[b] += G->cost_usec(x, y, z);
+                
+                /* Keep the costliest cells, costliest first */
+                i = (z*NY + y)*NX + x;
+                for(j=COST_HOT-1; j>=0 && (c->hot[j] < 0 || cu[i] > cu[c->hot[j]]); j--)
+                    if(j+1 < COST_HOT) c->hot[j+1] = c->hot[j];
+                if(j+1 < COST_HOT) c->hot[j+1] = i;
+                
+                if(usec) usec[i] = cu[i];
+            }
+    
+    for(b=0; b<COST_BUCKETS; b++)
+    {
+        c->total_nstp += c->nstp[b];
+        c->total_nrej += c->nrej[b];
+        c->total_usec += c->usec[b];
+    }
+    
+    if(usec && c->total_usec > 0)
+    {
+        qsort(usec, ncells, sizeof(uint32_t), compare_usec_desc);
+        sum = 0;
+        for(i=0; i<ncells; i++)
+        {
+            sum += usec[i];
+            if(i+1 == (ncells + 99) / 100)
+                c->top1 = (double)sum / c->total_usec;
+            if(i+1 == (ncells + 9) / 10)
+                c->top10 = (double)sum / c->total_usec;
+        }
+    }
+    free(usec);
+}
+
+static double percent(uint64_t part, uint64_t total)
+{
+    return total > 0 ? 100.0 * part / total : 0.0;
+}
+
+#endif
+
+/**
+ * Displays where the chemistry time went, cell by cell
+ */
+void print_chem_cost(fixedgrid_t* G)
+{
+#if DO_CHEMISTRY == 1 && CHEM_COST_MAP == 1
+    chem_cost_t c;
+    char label[32];
+    int32_t i, b, x, y, z;
+    
+    chem_cost_summary(G, &c);
+    
+    printf("\n===== Chemistry cost per cell =====\n");
+    printf("%-14s %10s %8s %8s %8s %8s\n", "Steps/call", "Cells", "Cells%", "Steps%", "Rej%", "Time%");
+    for(b=0; b<COST_BUCKETS; b++)
+    {
+        if(c.cells[b] == 0)
+            continue;
+        cost_bucket_label(b, label);
+        printf("%-14s %10lu %7.2f%% %7.2f%% %7.2f%% %7.2f%%\n", label, (unsigned long)c.cells[b],
+               percent(c.cells[b], NX*NY*NZ), percent(c.nstp[b], c.total_nstp),
+               percent(c.nrej[b], c.total_nrej), percent(c.usec[b], c.total_usec));
+    }
+    printf("Costliest 1%% of cells: %.1f%% of the time, 10%%: %.1f%%\n", 100.0*c.top1, 100.0*c.top10);
+    printf("Costliest cells (x,y,z: steps, rejected, msec):");
+    for(i=0; i<COST_HOT && c.hot[i] >= 0; i++)
+    {
+        x = c.hot[i] % NX;
+        y = (c.hot[i] / NX) % NY;
+        z = c.hot[i] / (NX*NY);
+        printf("%s %d,%d,%d: %u, %u, %.1f", i ? ";" : "", x, y, z,
+               G->cost_nstp(x, y, z), G->cost_nrej(x, y, z), 1.0e-3*G->cost_usec(x, y, z));
+    }
+    printf("\n");
+#endif
+}
+
+/**
+ * Writes the per-cell chemistry cost histogram to a CSV file
+ */
+void write_chem_cost_to_csv_file(fixedgrid_t* G, FILE* fptr)
+{
+#if DO_CHEMISTRY == 1 && CHEM_COST_MAP == 1
+    chem_cost_t c;
+    char label[32];
+    int32_t b;
+    
+    chem_cost_summary(G, &c);
+    
+    fprintf(fptr, "Chemistry cost,\n");
+    fprintf(fptr, "Steps/call,Cells,Steps,Rejected,Usec,\n");
+    for(b=0; b<COST_BUCKETS; b++)
+    {
+        cost_bucket_label(b, label);
+        fprintf(fptr, "%s,%lu,%lu,%lu,%lu,\n", label, (unsigned long)c.cells[b],
+                (unsigned long)c.nstp[b], (unsigned long)c.nrej[b], (unsigned long)c.usec[b]);
+    }
+    fprintf(fptr, "Top 1%% time share,%f,\n", c.top1);
+    fprintf(fptr, "Top 10%% time share,%f,\n", c.top10);
+    fprintf(fptr, ",\n,\n");
+#endif
+}
@@ -10,8 +10,20 @@
 #ifndef __CHEMISTRY_H__
 #define __CHEMISTRY_H__
 
+#include <stdio.h>
+
 #include "fixedgrid.h"
 
+void chem_init(fixedgrid_t* G);
+
+void saprc99_chem_row(fixedgrid_t* G, int32_t y, int32_t z);
+
 void saprc99_chem(fixedgrid_t* G);
 
+void print_chem_stats(fixedgrid_t* G);
+
+void print_chem_cost(fixedgrid_t* G);
+
+void write_chem_cost_to_csv_file(fixedgrid_t* G, FILE* fptr);
+
 #endif
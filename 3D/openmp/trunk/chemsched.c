@@ -0,0 +1,252 @@
+/*
+ *  chemsched.c
+ *
+ *  Chemistry load balancer.
+ *
+ *  The cost of integrating a cell varies by orders of magnitude
+ *  (near sources, at sunrise and sunset), so equal shares of cells
+ *  leave most threads waiting on the slowest one.  Each cell records
+ *  the integrator steps it took at the last chemistry call, and the
+ *  next call splits the rows (z*NY + y) into contiguous partitions of
+ *  equal predicted cost by a prefix sum.  Each thread works through
+ *  its own partition front to back; a thread that runs out steals
+ *  rows from the partition with the most left, so mispredictions
+ *  only cost the tail of the slowest partition.
+ *
+ *  With CHEM_BALANCE 0 the planes are handed out dynamically, as
+ *  before, and only the busy and idle times are recorded.
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <omp.h>
+
+#include "chemsched.h"
+#include "chemistry.h"
+#include "saprc99_Global.h"
+#include "trace.h"
+
+#define NROWS (NZ*NY)
+
+/**
+ * Allocates the partitions for G->nprocs threads
+ * and resets the busy and idle times
+ */
+void chem_sched_init(fixedgrid_t* G)
+{
+    uint32_t t, n;
+    chem_sched_t *S = &G->sched;
+
+    n = G->nprocs;
+
+    S->nthreads = n;
+    S->bounds = (int32_t*)malloc(sizeof(int32_t)*(n+1));
+    S->next   = (int32_t*)malloc(sizeof(int32_t)*n*SCHED_PAD);
+    S->busy   = (double*)malloc(sizeof(double)*n);
+    S->idle   = (double*)malloc(sizeof(double)*n);
+    if(!S->bounds || !S->next || !S->busy || !S->idle)
+    {
+        fprintf(stderr, "Couldn't allocate chemistry scheduler.\n");
+        exit(1);
+    }
+
+    for(t=0; t<n; t++)
+    {
+        S->busy[t] = 0.0;
+        S->idle[t] = 0.0;
+    }
+    S->stolen = 0;
+}
+
+/**
+ * Splits the rows into nthreads contiguous partitions of
+ * about equal cost.  A cell costs the steps it took last
+ * time plus one for gathering it.
+ */
+void chem_sched_partition(fixedgrid_t* G, int nthreads)
+{
+#if DO_CHEMISTRY == 1
+    int32_t x, y, z, r, t;
+    uint64_t total, sum, row;
+    chem_sched_t *S = &G->sched;
+
+    total = 0;
+    for(z=0; z<NZ; z++)
+        for(y=0; y<NY; y++)
+            for(x=0; x<NX; x++)
+                total += G->cost(x, y, z) + 1;
+
+    /* Row r starts partition t once the cost of rows 0..r-1
+     * reaches t/nthreads of the total */
+    S->bounds[0] = 0;
+    t = 1;
+    sum = 0;
+    for(r=0; r<NROWS && t<nthreads; r++)
+    {
+        row = 0;
+        for(x=0; x<NX; x++)
+            row += G->cost(x, r % NY, r / NY) + 1;
+
+        while(t < nthreads && sum*nthreads >= t*total)
+            S->bounds[t++] = r;
+
+        sum += row;
+    }
+    while(t <= nthreads)
+        S->bounds[t++] = NROWS;
+
+    for(t=0; t<nthreads; t++)
+        S->next[t*SCHED_PAD] = S->bounds[t];
+#endif
+}
+
+/**
+ * Claims the next row of partition t, or returns -1 if none are left
+ */
+static inline int32_t claim_row(chem_sched_t *S, int t)
+{
+    int32_t r;
+
+    #pragma omp atomic capture
+    r = S->next[t*SCHED_PAD]++;
+
+    return r < S->bounds[t+1] ? r : -1;
+}
+
+/**
+ * Returns the partition with the most unclaimed rows,
+ * or -1 if every partition is finished
+ */
+static inline int find_victim(chem_sched_t *S, int nthreads)
+{
+    int t, victim;
+    int32_t next, left, most;
+
+    victim = -1;
+    most = 0;
+    for(t=0; t<nthreads; t++)
+    {
+        #pragma omp atomic read
+        next = S->next[t*SCHED_PAD];
+
+        left = S->bounds[t+1] - next;
+        if(left > most)
+        {
+            most = left;
+            victim = t;
+        }
+    }
+
+    return victim;
+}
+
+/**
+ * Applies the chemical mechanism to every row, recording the time
+ * each thread spends integrating and waiting for the others
+ */
+void chem_sched_run(fixedgrid_t* G)
+{
+#if DO_CHEMISTRY == 1
+    chem_sched_t *S = &G->sched;
+    uint64_t stolen = 0;
+
+    #pragma omp parallel shared(G, S) reduction(+: stolen) copyin(RCONST)
+    {
+        int t = omp_get_thread_num();
+        double start, busy, now;
+#if CHEM_BALANCE == 1
+        int nthreads = omp_get_num_threads();
+        int victim;
+        int32_t r;
+#else
+        int32_t y, z;
+#endif
+
+        start = omp_get_wtime();
+        busy = 0.0;
+        trace_begin("Chemistry rows");
+
+#if CHEM_BALANCE == 1
+
+        #pragma omp single
+        chem_sched_partition(G, nthreads);
+
+        /* Own partition, front to back */
+        while((r = claim_row(S, t)) >= 0)
+        {
+            now = omp_get_wtime();
+            saprc99_chem_row(G, r % NY, r / NY);
+            busy += omp_get_wtime() - now;
+        }
+
+        /* Steal from the partition with the most left */
+        trace_begin("Steal");
+        while((victim = find_victim(S, nthreads)) >= 0)
+        {
+            if((r = claim_row(S, victim)) >= 0)
+            {
+                now = omp_get_wtime();
+                saprc99_chem_row(G, r % NY, r / NY);
+                busy += omp_get_wtime() - now;
+                ++stolen;
+            }
+        }
+        trace_end();
+
+#else
+
+        #pragma omp for schedule(dynamic) nowait
+        for(z=0; z<NZ; z++)
+        {
+            now = omp_get_wtime();
+            for(y=0; y<NY; y++)
+            {
+                saprc99_chem_row(G, y, z);
+            }
+            busy += omp_get_wtime() - now;
+        }
+
+#endif
+
+        trace_end();
+        
+        /* Wait for the slowest thread */
+        trace_barrier();
+
+        S->busy[t] += busy;
+        S->idle[t] += omp_get_wtime() - start - busy;
+    }
+
+    S->stolen += stolen;
+#endif
+}
+
+/**
+ * Displays the time each thread spent integrating and waiting
+ */
+void print_chem_sched(fixedgrid_t* G)
+{
+#if DO_CHEMISTRY == 1
+    uint32_t t;
+    double busy, idle;
+    chem_sched_t *S = &G->sched;
+
+    printf("Chemistry threads (%s):\n", CHEM_BALANCE == 1 ? "cost-balanced partitions" : "dynamic planes");
+    busy = idle = 0.0;
+    for(t=0; t<S->nthreads; t++)
+    {
+        printf("    Thread %2d: busy %10.4f sec  idle %10.4f sec (%5.1f%%)\n",
+               t, S->busy[t], S->idle[t],
+               S->busy[t] + S->idle[t] > 0.0 ? 100.0*S->idle[t] / (S->busy[t] + S->idle[t]) : 0.0);
+        busy += S->busy[t];
+        idle += S->idle[t];
+    }
+    printf("    Total:     busy %10.4f sec  idle %10.4f sec (%5.1f%%)  rows stolen %llu\n",
+           busy, idle, busy + idle > 0.0 ? 100.0*idle / (busy + idle) : 0.0,
+           (unsigned long long)S->stolen);
+#endif
+}
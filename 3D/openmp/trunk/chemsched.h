@@ -0,0 +1,44 @@
+/*
+ *  chemsched.h
+ *
+ *  Chemistry load balancer.
+ *  Splits the rows of the domain among threads so that each thread
+ *  gets about the same number of integrator steps, predicted from
+ *  the steps each cell took at the previous chemistry call, and
+ *  lets threads that finish early steal rows from the others.
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#ifndef __CHEMSCHED_H__
+#define __CHEMSCHED_H__
+
+/**************************************************
+ * Includes                                       *
+ **************************************************/
+
+#include "fixedgrid.h"
+#include "params.h"
+
+/**************************************************
+ * Macros                                         *
+ **************************************************/
+
+/* Stride between partition counters (one cache line) */
+#define SCHED_PAD 16
+
+/**************************************************
+ * Function prototypes                            *
+ **************************************************/
+
+void chem_sched_init(fixedgrid_t* G);
+
+void chem_sched_partition(fixedgrid_t* G, int nthreads);
+
+void chem_sched_run(fixedgrid_t* G);
+
+void print_chem_sched(fixedgrid_t* G);
+
+#endif
@@ -0,0 +1,82 @@
+#!/bin/bash
+#
+# Checks the accuracy of multi-rate chemistry against running
+# chemistry on every transport step.  Builds and runs fixedgrid
+# with CHEM_STRIDE=1 and with each of the given strides (0 is
+# adaptive) and compares the final concentration of every
+# monitored species.
+#
+# usage: ./compare_chemrate.sh [threads] [strides] [-- make options]
+#   e.g. ./compare_chemrate.sh 8 "2 4 0" -- CC=gcc LD=gcc CFLAGS="-O3 -fopenmp" LDFLAGS="-fopenmp -lm"
+#
+# Every build has DO_CHEMISTRY 1 and the stride being tested; a DEFS=
+# among the make options is added to these, e.g. DEFS="-DNX=12 -DNY=12".
+#
+# TOL is a bound on the relative L2 difference.  Lengthening the
+# chemistry step adds splitting error between chemistry and transport,
+# which grows with the stride and dominates the integrator tolerance:
+# a stride of 4 differed by up to 9% in O3 on a 12x12x4 grid.
+#
+
+NPROCS=${1:-1}
+shift
+STRIDES=${1:-"2 4 0"}
+shift
+[ "$1" == "--" ] && shift
+
+TOL=${TOL:-0.1}
+OUT=Output
+
+# Keep the user's DEFS apart so they add to ours instead of replacing them
+USER_DEFS=""
+MAKE_ARGS=()
+for arg in "$@" ; do
+	case "$arg" in
+		DEFS=*) USER_DEFS="$USER_DEFS ${arg#DEFS=}" ;;
+		*)      MAKE_ARGS+=("$arg") ;;
+	esac
+done
+
+mkdir -p $OUT
+
+STATUS=0
+for k in 1 $STRIDES ; do
+	name=stride$k
+	echo -n "Building and running with CHEM_STRIDE=$k..."
+	make clean > /dev/null
+	make DEFS="-DDO_CHEMISTRY=1 -DCHEM_STRIDE=$k$USER_DEFS" "${MAKE_ARGS[@]}" > $OUT/build_$name.out 2>&1 || { echo " build failed!" ; exit 1 ; }
+	rm -rf $OUT/$name
+	./fixedgrid $NPROCS > $OUT/fixedgrid_$name.out 2>&1 || { echo " failed!" ; exit 1 ; }
+	if ! grep -q "SAPRC99 CHEMISTRY:  TRUE" $OUT/fixedgrid_$name.out ; then
+		echo " chemistry is off, nothing to compare!"
+		exit 1
+	fi
+	mkdir -p $OUT/$name
+	mv $OUT/OUT_solution_* $OUT/$name/
+	echo " done!"
+	grep -E "Chemistry steps|Chemistry  " $OUT/fixedgrid_$name.out | sed 's/^ */    /'
+
+	[ $k == 1 ] && continue
+
+	# Final iteration written
+	LAST=`ls $OUT/stride1 | cut -d_ -f5 | sort | tail -n 1`
+
+	for ref in `ls $OUT/stride1 | grep "_${LAST}$"` ; do
+		awk -v name=$ref -v tol=$TOL '
+			NR == FNR { a[FNR] = $4 ; next }
+			{
+				d = $4 - a[FNR]
+				if(d < 0) d = -d
+				if(d > maxdiff) maxdiff = d
+				l2 += d*d
+				n2 += a[FNR]*a[FNR]
+			}
+			END {
+				rel = (n2 > 0) ? sqrt(l2/n2) : 0
+				printf("    %s: max |diff| %E  rel L2 %E\n", name, maxdiff, rel)
+				if(rel > tol) { printf("        rel L2 exceeds %s\n", tol) ; exit 1 }
+			}' $OUT/stride1/$ref $OUT/$name/$ref || STATUS=1
+	done
+done
+
+exit $STATUS
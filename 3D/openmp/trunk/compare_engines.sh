@@ -0,0 +1,51 @@
+#!/bin/bash
+#
+# Cross-checks the unsplit transport engine against the
+# Strang-split sweeps.  Runs fixedgrid once with each engine
+# and compares the final concentration of every monitored species.
+#
+# usage: ./compare_engines.sh [threads]
+#
+# The two schemes differ by their splitting error, which shrinks
+# with the timestep, so TOL is a sanity bound on the relative
+# L2 difference rather than a bit-for-bit check.
+#
+
+NPROCS=${1:-1}
+TOL=${TOL:-0.5}
+OUT=Output
+
+for engine in split unsplit ; do
+	echo -n "Running fixedgrid $NPROCS -$engine..."
+	rm -rf $OUT/$engine
+	./fixedgrid $NPROCS -$engine > $OUT/fixedgrid_$engine.out 2>&1 || { echo " failed!" ; exit 1 ; }
+	mkdir -p $OUT/$engine
+	mv $OUT/OUT_solution_* $OUT/$engine/
+	echo " done!"
+	grep -E "Wallclock|discret|Unsplit|Transport" $OUT/fixedgrid_$engine.out | sed 's/^/    /'
+done
+
+# Final iteration written
+LAST=`ls $OUT/split | cut -d_ -f5 | sort | tail -n 1`
+
+STATUS=0
+for ref in `ls $OUT/split | grep "_${LAST}$"` ; do
+	awk -v name=$ref -v tol=$TOL '
+		NR == FNR { a[FNR] = $4 ; next }
+		{
+			d = $4 - a[FNR]
+			if(d < 0) d = -d
+			if(d > maxdiff) maxdiff = d
+			l2 += d*d
+			n2 += a[FNR]*a[FNR]
+			ms += a[FNR]
+			mu += $4
+		}
+		END {
+			rel = (n2 > 0) ? sqrt(l2/n2) : 0
+			printf("%s: max |diff| %E  rel L2 %E  mass split %E unsplit %E\n", name, maxdiff, rel, ms, mu)
+			if(rel > tol) { printf("    rel L2 exceeds %s\n", tol) ; exit 1 }
+		}' $OUT/split/$ref $OUT/unsplit/$ref || STATUS=1
+done
+
+exit $STATUS
@@ -0,0 +1,83 @@
+#!/bin/bash
+#
+# Checks the accuracy of mixed precision (single precision fields,
+# double precision chemistry) against the all-double build.
+# Builds and runs fixedgrid once with each precision and compares
+# the final concentration of every monitored species.
+#
+# usage: ./compare_precision.sh [threads] [-- make options]
+#   e.g. ./compare_precision.sh 8 -- CC=gcc LD=gcc CFLAGS="-O3 -fopenmp" LDFLAGS="-fopenmp -lm"
+#
+# Builds have DO_CHEMISTRY $CHEM (default 1; CHEM=0 compares the ozone
+# plume alone) and the precision being tested; a DEFS= among the make
+# options is added to these, e.g. DEFS="-DNX=16 -DNY=16".  The physics
+# each build ran is printed from its banner.
+#
+# TOL is a bound on the relative L2 difference.  Single precision
+# carries about seven significant digits, so the difference should
+# stay a few orders of magnitude below it.
+#
+
+NPROCS=${1:-1}
+shift
+[ "$1" == "--" ] && shift
+
+TOL=${TOL:-1e-3}
+CHEM=${CHEM:-1}
+OUT=Output
+NAMES=("single" "double")
+
+# Keep the user's DEFS apart so they add to ours instead of replacing them
+USER_DEFS=""
+MAKE_ARGS=()
+for arg in "$@" ; do
+	case "$arg" in
+		DEFS=*) USER_DEFS="$USER_DEFS ${arg#DEFS=}" ;;
+		*)      MAKE_ARGS+=("$arg") ;;
+	esac
+done
+
+mkdir -p $OUT
+
+for prec in 1 0 ; do
+	name=${NAMES[$prec]}
+	echo -n "Building and running with DOUBLE_PRECISION=$prec..."
+	make clean > /dev/null
+	make DEFS="-DDO_CHEMISTRY=$CHEM -DDOUBLE_PRECISION=$prec$USER_DEFS" "${MAKE_ARGS[@]}" > $OUT/build_$name.out 2>&1 || { echo " build failed!" ; exit 1 ; }
+	rm -rf $OUT/$name
+	./fixedgrid $NPROCS > $OUT/fixedgrid_$name.out 2>&1 || { echo " failed!" ; exit 1 ; }
+	if [ $CHEM == 1 ] && ! grep -q "SAPRC99 CHEMISTRY:  TRUE" $OUT/fixedgrid_$name.out ; then
+		echo " chemistry is off, set CHEM=0 to compare transport alone!"
+		exit 1
+	fi
+	mkdir -p $OUT/$name
+	mv $OUT/OUT_solution_* $OUT/$name/
+	echo " done!"
+	echo "    Physics:" `grep -E "(X|Y|Z) DISCRETIZATION|SAPRC99 CHEMISTRY" $OUT/fixedgrid_$name.out | sed -e 's/ *DISCRETIZATION: */ transport /' -e 's/ *SAPRC99 CHEMISTRY: */ chemistry /' -e 's/^ *//' | paste -sd,`
+	grep -E "FIELD STORAGE|Wallclock|discret|Chemistry  " $OUT/fixedgrid_$name.out | sed 's/^ */    /'
+done
+
+# Final iteration written
+LAST=`ls $OUT/double | cut -d_ -f5 | sort | tail -n 1`
+
+STATUS=0
+for ref in `ls $OUT/double | grep "_${LAST}$"` ; do
+	awk -v name=$ref -v tol=$TOL '
+		NR == FNR { a[FNR] = $4 ; next }
+		{
+			d = $4 - a[FNR]
+			if(d < 0) d = -d
+			r = (a[FNR] != 0) ? d / (a[FNR] < 0 ? -a[FNR] : a[FNR]) : 0
+			if(d > maxdiff) maxdiff = d
+			if(r > maxrel) maxrel = r
+			l2 += d*d
+			n2 += a[FNR]*a[FNR]
+		}
+		END {
+			rel = (n2 > 0) ? sqrt(l2/n2) : 0
+			printf("%s: max |diff| %E  max rel %E  rel L2 %E\n", name, maxdiff, maxrel, rel)
+			if(rel > tol) { printf("    rel L2 exceeds %s\n", tol) ; exit 1 }
+		}' $OUT/double/$ref $OUT/single/$ref || STATUS=1
+done
+
+exit $STATUS
@@ -17,12 +17,23 @@
 /* Output directory */
 #define OUTPUT_DIR  "Output"
 
-/* 1 for double precision, 0 for single */
+/* 1 for double precision, 0 for single precision storage.
+ * Chemistry is always integrated in double precision.
+ * May be overridden on the command line (-DDOUBLE_PRECISION=0) */
+#ifndef DOUBLE_PRECISION
 #define DOUBLE_PRECISION 1
+#endif
 
 /* 1 to write output each iteration */
 #define WRITE_EACH_ITER 0
 
+/* 1 to count hardware events (cycles, instructions, cache and
+ * branch misses) per phase and thread with Linux perf events.
+ * May be overridden on the command line (-DHW_COUNTERS=1) */
+#ifndef HW_COUNTERS
+#define HW_COUNTERS 0
+#endif
+
 /* 1 to discretize along x axis each iteration */
 #define DO_X_DISCRET 1
 
@@ -33,23 +44,166 @@
 #define DO_Z_DISCRET 1
 
 /* 1 to run chemical mechanism each iteration,
- * otherwise only process ozone */
+ * otherwise only process ozone.
+ * May be overridden on the command line (-DDO_CHEMISTRY=1) */
+#ifndef DO_CHEMISTRY
 #define DO_CHEMISTRY 0
+#endif
+
+/* Cells transposed into each chemistry batch */
+#define CHEM_BLOCK 16
+
+/* 1 to factor the Rosenbrock stage matrices in single precision
+ * and refine each solve once in double precision.
+ * May be overridden on the command line (-DCHEM_MIXED_LU=1) */
+#ifndef CHEM_MIXED_LU
+#define CHEM_MIXED_LU 0
+#endif
+
+/* 1 to start each cell's integration from the last step size
+ * accepted in that cell, 0 to start every cell from STEPMIN.
+ * May be overridden on the command line (-DCHEM_WARM_START=0) */
+#ifndef CHEM_WARM_START
+#define CHEM_WARM_START 1
+#endif
+
+/* 1 to balance chemistry across threads by the integrator steps
+ * each cell took at the last call, 0 to hand out z-planes dynamically.
+ * May be overridden on the command line (-DCHEM_BALANCE=0) */
+#ifndef CHEM_BALANCE
+#define CHEM_BALANCE 1
+#endif
+
+/* Transport steps per chemistry step, or 0 to choose adaptively.
+ * May be overridden on the command line (-DCHEM_STRIDE=0) */
+#ifndef CHEM_STRIDE
+#define CHEM_STRIDE 1
+#endif
+
+/* Most transport steps per chemistry step when chosen adaptively */
+#define CHEM_STRIDE_MAX 12
+
+/* Largest change in SUN over one adaptive chemistry step */
+#define CHEM_SUN_TOL 0.05
+
+/* 1 to use the ODE function and Jacobian with the photolysis
+ * reactions removed whenever SUN is zero (chem/gen_dark.sh).
+ * May be overridden on the command line (-DCHEM_DARK_KERNELS=0) */
+#ifndef CHEM_DARK_KERNELS
+#define CHEM_DARK_KERNELS 1
+#endif
+
+/* 1 to update the rate coefficients once for the ODE function
+ * and Jacobian at the start of each Rosenbrock step.
+ * May be overridden on the command line (-DCHEM_FUSED_FUNJAC=0) */
+#ifndef CHEM_FUSED_FUNJAC
+#define CHEM_FUSED_FUNJAC 1
+#endif
+
+/* 1 to compute the time derivative of the ODE function from the
+ * derivative of SUN instead of by finite differences, and to skip
+ * it when SUN is constant (night).
+ * May be overridden on the command line (-DCHEM_ANALYTIC_DFDT=0) */
+#ifndef CHEM_ANALYTIC_DFDT
+#define CHEM_ANALYTIC_DFDT 1
+#endif
+
+/* 1 to record the integrator steps, rejected steps and time of
+ * every cell, summed over the chemistry calls, and write them
+ * with the concentrations as the species NSTP, NREJ and USEC.
+ * May be overridden on the command line (-DCHEM_COST_MAP=1) */
+#ifndef CHEM_COST_MAP
+#define CHEM_COST_MAP 0
+#endif
+
+/* 1 to merge the trailing x half-step of each timestep with
+ * the leading x half-step of the next when possible.  Saves one
+ * sweep per step but is less accurate (see README).
+ * May be overridden on the command line (-DMERGE_HALF_STEPS=1) */
+#ifndef MERGE_HALF_STEPS
+#define MERGE_HALF_STEPS 0
+#endif
+
+/* 1 to run chemistry and the x and y sweeps one z-plane
+ * at a time so each plane is read from memory once per step.
+ * May be overridden on the command line (-DPLANE_PIPELINE=1) */
+#ifndef PLANE_PIPELINE
+#define PLANE_PIPELINE 0
+#endif
+
+/* 1 to advance transport with the unsplit 3D stencil by default,
+ * 0 for Strang-split directional sweeps.
+ * Either can be chosen at runtime with -unsplit or -split.
+ * May be overridden on the command line (-DUNSPLIT_TRANSPORT=1) */
+#ifndef UNSPLIT_TRANSPORT
+#define UNSPLIT_TRANSPORT 0
+#endif
 
-/* Time */
+/* Tile size of the unsplit stencil.  Each tile marches along
+ * y through UNSPLIT_ZBLOCK levels so the z neighborhood of
+ * a row stays in cache. */
+#define UNSPLIT_ZBLOCK 4
+#define UNSPLIT_YBLOCK 16
+
+/* Memory layout of the concentration field:
+ *   0  species-outer [s][z][y][x]
+ *   1  cell-outer    [z][y][x][s]
+ *   2  blocked       [z][y][x/CONC_XLANE][s][x%CONC_XLANE]
+ * May be overridden on the command line (-DCONC_LAYOUT=n) */
+#ifndef CONC_LAYOUT
+#define CONC_LAYOUT 0
+#endif
+
+/* Cells per block in the blocked layout */
+#ifndef CONC_XLANE
+#define CONC_XLANE 8
+#endif
+
+/* Time.  The start and end hour and minute
+ * may be overridden on the command line (-DEND_HOUR=n) */
 #define START_YEAR  2000
 #define START_DOY   100
+#ifndef START_HOUR
 #define START_HOUR  0
+#endif
+#ifndef START_MIN
 #define START_MIN   0
+#endif
 
 #define END_YEAR    2000
 #define END_DOY     100
+#ifndef END_HOUR
 #define END_HOUR    1
+#endif
+#ifndef END_MIN
 #define END_MIN     0
+#endif
 
 /* Timestep size (sec) */
 #define STEP_SIZE   50
 
+/* 1 to choose each timestep from the Courant and diffusion
+ * numbers of the wind and diffusion fields, otherwise STEP_SIZE is used.
+ * May be overridden on the command line (-DADAPTIVE_STEP=1) */
+#ifndef ADAPTIVE_STEP
+#define ADAPTIVE_STEP 0
+#endif
+
+/* Largest timestep the stability controller may choose (sec) */
+#define STEP_SIZE_MAX 600
+
+/* Stability limits of the explicit transport scheme.
+ * Sweeps exceeding these are split into substeps. */
+#define COURANT_MAX 0.8
+#define DIFFNUM_MAX 0.4
+
+/* 1 to solve vertical diffusion implicitly (backward Euler),
+ * otherwise it is explicit and subject to DIFFNUM_MAX.
+ * May be overridden on the command line (-DIMPLICIT_Z_DIFFUSION=1) */
+#ifndef IMPLICIT_Z_DIFFUSION
+#define IMPLICIT_Z_DIFFUSION 0
+#endif
+
 /* Initial wind vector (m/s) */
 #define WIND_U_INIT 5.0
 #define WIND_V_INIT 0.0
@@ -65,24 +219,66 @@
 /* Default O3 concentration */
 #define O3_INIT     8.61E+09
 
-/* Matrix dimensions */
+/* Matrix dimensions.
+ * May be overridden on the command line (-DNX=n) */
+#ifndef NY
 #define NY          200
+#endif
+#ifndef NX
 #define NX          200
+#endif
+#ifndef NZ
 #define NZ          24
+#endif
 
 /* Cell dimensions */
 #define DX          1000.0
 #define DY          1000.0
 #define DZ          1000.0
 
-/* Emission source point coordinates */
+/* Emission source point coordinates.
+ * May be overridden on the command line (-DSOURCE_X=n) */
+#ifndef SOURCE_X
 #define SOURCE_X    100
+#endif
+#ifndef SOURCE_Y
 #define SOURCE_Y    100
+#endif
+#ifndef SOURCE_Z
 #define SOURCE_Z    12
+#endif
 
 /* Emission source emission rate (mol/m^2/s) */
 #define SOURCE_RATE	4.67E+23
 
+/* Synthetic scenario (see scenario.c).  0 for the uniform fields
+ * and single source above, 1 for a rotating wind, 2 for a shear wind.
+ * Scenarios 1 and 2 have time-dependent winds, diffusion and
+ * temperature and SCENARIO_SOURCES diurnal emission sources.
+ * May be overridden at runtime with -scenario n, or on the
+ * command line (-DSCENARIO=n) */
+#ifndef SCENARIO
+#define SCENARIO 0
+#endif
+
+/* Seed of the random phases and sources of the synthetic scenario.
+ * May be overridden at runtime with -seed n, or on the
+ * command line (-DSCENARIO_SEED=n) */
+#ifndef SCENARIO_SEED
+#define SCENARIO_SEED 1
+#endif
+
+/* Emission sources of the synthetic scenario.
+ * May be overridden on the command line (-DSCENARIO_SOURCES=n) */
+#ifndef SCENARIO_SOURCES
+#define SCENARIO_SOURCES 32
+#endif
+
+/* Peak wind speed (m/s) and median peak emission rate
+ * (molecules/cm^3/s) of the synthetic scenario */
+#define SCENARIO_WIND 10.0
+#define SCENARIO_RATE 1.0E+08
+
 #include "precision.h"
 
 #include "saprc99_Parameters.h"
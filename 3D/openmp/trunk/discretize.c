@@ -4,6 +4,15 @@
 
 extern fixedgrid_t G_GLOBAL;
 
+/* Constants in working precision, so single precision
+ * kernels are not silently promoted to double */
+#define ZERO  ((real_t)0.0)
+#define HALF  ((real_t)0.5)
+#define ONE   ((real_t)1.0)
+#define TWO   ((real_t)2.0)
+#define FIVE  ((real_t)5.0)
+#define SIXTH ((real_t)(1.0/6.0))
+
 /* 
  * The core upwinded advection/diffusion equation.
  * c = conc, w = wind, d = diff
@@ -21,13 +30,13 @@ advec_diff(real_t cell_size,
 {
     real_t wind, diff_term, advec_term, advec_termL, advec_termR;
     
-    wind = (w1l + w) / 2.0;
-    if(wind >= 0.0) advec_termL = (1.0/6.0) * ( -c2l + 5.0*c1l + 2.0*c );
-    else advec_termL = (1.0/6.0) * ( 2.0*c1l + 5.0*c - c1r );
+    wind = (w1l + w) / TWO;
+    if(wind >= ZERO) advec_termL = SIXTH * ( -c2l + FIVE*c1l + TWO*c );
+    else advec_termL = SIXTH * ( TWO*c1l + FIVE*c - c1r );
     advec_termL *= wind;
-    wind = (w1r + w) / 2.0;
-    if(wind >= 0.0) advec_termR = (1.0/6.0) * ( -c1l + 5.0*c + 2.0*c1r );
-    else advec_termR = (1.0/6.0) * ( 2.0*c + 5.0*c1r - c2r );
+    wind = (w1r + w) / TWO;
+    if(wind >= ZERO) advec_termR = SIXTH * ( -c1l + FIVE*c + TWO*c1r );
+    else advec_termR = SIXTH * ( TWO*c + FIVE*c1r - c2r );
     advec_termR *= wind;
     advec_term = (advec_termL - advec_termR) / cell_size;
     diff_term = ( ((d1l+d)/2)*(c1l-c) - ((d+d1r)/2)*(c-c1r) ) / (cell_size * cell_size);
@@ -119,8 +128,148 @@ void discretize(const int n, real_t *conc_in, real_t *wind,
     
     for(i=0; i<n; i++)
     {
-        conc_out[i] = 0.5 * (conc_out[i] + c[i]);
-        if(conc_out[i] < 0.0)
-            conc_out[i] = 0.0;
+        conc_out[i] = HALF * (conc_out[i] + c[i]);
+        if(conc_out[i] < ZERO)
+            conc_out[i] = ZERO;
+    }
+}
+
+/*
+ * Sum of the advection / diffusion terms along all three axes
+ * for cell i of an x-row.  im2 .. ip2 are the (periodic) x indices
+ * of its neighbors.  The row itself is sy->c[2] == sz->c[2].
+ */
+static inline real_t
+advec_diff_cell(const int i, const int im2, const int im1,
+                const int ip1, const int ip2,
+                real_t *u, real_t *dh, stencil_t *sy, stencil_t *sz)
+{
+    real_t *c = sy->c[2];
+    real_t dcdt = ZERO;
+    
+#if DO_X_DISCRET == 1
+    dcdt += advec_diff(DX,
+                       c[im2], u[im2], dh[im2],  /* 2-left neighbors */
+                       c[im1], u[im1], dh[im1],  /* 1-left neighbors */
+                       c[i],   u[i],   dh[i],    /* Values */
+                       c[ip1], u[ip1], dh[ip1],  /* 1-right neighbors */
+                       c[ip2], u[ip2], dh[ip2]); /* 2-right neighbors */
+#endif
+    
+#if DO_Y_DISCRET == 1
+    dcdt += advec_diff(DY,
+                       sy->c[0][i], sy->w[0][i], sy->d[0][i],
+                       sy->c[1][i], sy->w[1][i], sy->d[1][i],
+                       sy->c[2][i], sy->w[2][i], sy->d[2][i],
+                       sy->c[3][i], sy->w[3][i], sy->d[3][i],
+                       sy->c[4][i], sy->w[4][i], sy->d[4][i]);
+#endif
+    
+#if DO_Z_DISCRET == 1
+    dcdt += advec_diff(DZ,
+                       sz->c[0][i], sz->w[0][i], sz->d[0][i],
+                       sz->c[1][i], sz->w[1][i], sz->d[1][i],
+                       sz->c[2][i], sz->w[2][i], sz->d[2][i],
+                       sz->c[3][i], sz->w[3][i], sz->d[3][i],
+                       sz->c[4][i], sz->w[4][i], sz->d[4][i]);
+#endif
+    
+    return dcdt;
+}
+
+/*
+ * Applies the advection / diffusion equation along x, y and z
+ * to one x-row in a single pass.  u and dh are the x-axis wind
+ * and diffusion of the row, sy and sz its y and z neighborhoods.
+ * Rows are periodic in x.
+ */
+void advec_diff_3d(const int n, real_t *u, real_t *dh,
+                   stencil_t *sy, stencil_t *sz, real_t *dcdt)
+{
+    int i;
+    
+    /* Do boundary cells explicitly */
+    dcdt[0] = advec_diff_cell(0, n-2, n-1, 1, 2, u, dh, sy, sz);
+    dcdt[1] = advec_diff_cell(1, n-1, 0, 2, 3, u, dh, sy, sz);
+    
+    /* Interior is unit-stride in every row */
+    #pragma omp simd
+    for(i=2; i<n-2; i++)
+    {
+        dcdt[i] = advec_diff_cell(i, i-2, i-1, i+1, i+2, u, dh, sy, sz);
+    }
+    
+    dcdt[n-2] = advec_diff_cell(n-2, n-4, n-3, n-1, 0, u, dh, sy, sz);
+    dcdt[n-1] = advec_diff_cell(n-1, n-3, n-2, 0, 1, u, dh, sy, sz);
+}
+
+/*
+ * Backward Euler vertical diffusion of n columns at once.
+ * Level k of column i is conc[k*cstride + i] and diff[k*dstride + i].
+ * Face diffusivities are averaged as in advec_diff and the
+ * bottom and top faces are zero-flux.  The tridiagonal systems
+ * are solved with the Thomas algorithm, sweeping all n columns
+ * together so the inner loops are unit-stride.
+ * work must hold nz*n values.
+ */
+void vdiff_implicit(const int nz, const int n,
+                    real_t *conc, const int cstride,
+                    real_t *diff, const int dstride,
+                    real_t cell_size, real_t dt, real_t *work)
+{
+    int i, k;
+    real_t r, lo, up, m;
+    real_t *c, *d, *cp, *cm, *dm;
+    
+    r = dt / (cell_size * cell_size);
+    
+    /* Forward elimination, level 0 */
+    c  = conc;
+    d  = diff;
+    cp = work;
+    for(i=0; i<n; i++)
+    {
+        up = (nz > 1) ? r * HALF * (d[i] + d[i+dstride]) : ZERO;
+        m = ONE + up;
+        cp[i] = -up / m;
+        c[i] = c[i] / m;
+    }
+    
+    /* Forward elimination, levels 1 .. nz-1 */
+    for(k=1; k<nz; k++)
+    {
+        c  = conc + k*cstride;
+        cm = conc + (k-1)*cstride;
+        d  = diff + k*dstride;
+        dm = diff + (k-1)*dstride;
+        cp = work + k*n;
+        for(i=0; i<n; i++)
+        {
+            lo = r * HALF * (dm[i] + d[i]);
+            up = (k < nz-1) ? r * HALF * (d[i] + d[i+dstride]) : ZERO;
+            m = ONE + lo + up + lo * cp[i-n];
+            cp[i] = -up / m;
+            c[i] = (c[i] + lo * cm[i]) / m;
+        }
+    }
+    
+    /* Back substitution */
+    for(k=nz-2; k>=0; k--)
+    {
+        c  = conc + k*cstride;
+        cm = conc + (k+1)*cstride;
+        cp = work + k*n;
+        for(i=0; i<n; i++)
+        {
+            c[i] -= cp[i] * cm[i];
+            if(c[i] < ZERO)
+                c[i] = ZERO;
+        }
+    }
+    c = conc + (nz-1)*cstride;
+    for(i=0; i<n; i++)
+    {
+        if(c[i] < ZERO)
+            c[i] = ZERO;
     }
 }
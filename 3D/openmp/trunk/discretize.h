@@ -19,19 +19,47 @@
 #include <stdint.h>
 #include "params.h"
 
+/**************************************************
+ * Data types                                     *
+ **************************************************/
+
+/* Rows of a field surrounding an x-row along one axis.
+ * Index 0..4 is offset -2..+2 along the axis. */
+typedef struct stencil
+{
+    real_t *c[5];
+    real_t *w[5];
+    real_t *d[5];
+} stencil_t;
+
 /**************************************************
  * Function prototypes                            *
  **************************************************/
 
-void space_advec_diff_row(int n,  real_t *c,  real_t *w,  real_t *d, 
-                          real_t *cb, real_t *wb, real_t *db, real_t cell_size, 
-                           real_t *dcdx);
+real_t advec_diff(real_t cell_size,
+                  real_t c2l, real_t w2l, real_t d2l, 
+                  real_t c1l, real_t w1l, real_t d1l, 
+                  real_t   c, real_t   w, real_t   d, 
+                  real_t c1r, real_t w1r, real_t d1r, 
+                  real_t c2r, real_t w2r, real_t d2r);
+
+void space_advec_diff(const uint32_t n, real_t *c, real_t *w, real_t *d, 
+                      real_t *cb, real_t *wb, real_t *db, real_t cell_size, 
+                      real_t *dcdx);
 
 void discretize(const int n,  real_t *conc_in,  real_t *wind, 
                  real_t *diff, real_t *concbound, real_t *windbound, 
                 real_t *diffbound, real_t cell_size, real_t dt, 
                  real_t *conc_out);
 
+void advec_diff_3d(const int n, real_t *u, real_t *dh,
+                   stencil_t *sy, stencil_t *sz, real_t *dcdt);
+
+void vdiff_implicit(const int nz, const int n,
+                    real_t *conc, const int cstride,
+                    real_t *diff, const int dstride,
+                    real_t cell_size, real_t dt, real_t *work);
+
 
 #endif
 
@@ -1,16 +1,28 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <omp.h>
 
 #include "fixedgrid.h"
 #include "params.h"
 #include "timer.h"
+#include "counters.h"
+#include "trace.h"
 #include "fileio.h"
 #include "saprc99_Monitor.h"
 #include "chemistry.h"
 #include "transport.h"
+#include "splitting.h"
+#include "cfl.h"
+#include "unsplit.h"
+#include "pipeline.h"
+#include "chemsched.h"
+#include "multirate.h"
+#include "chemcapture.h"
+#include "roofline.h"
+#include "scenario.h"
 
-void saprc99_Initialize(real_t C[NSPEC]);
+void saprc99_Initialize(double C[NSPEC]);
 
 fixedgrid_t G_GLOBAL;
 
@@ -27,6 +39,9 @@ double SUN;                 /* Sunlight intensity between [0,1] */
 double TEMP;                /* Temperature */
 double STEPMIN;             /* Lower bound for integration step */
 
+/* Each thread integrates its own cells */
+#pragma omp threadprivate(C, VAR, FIX, RCONST, TIME, SUN, TEMP, DT)
+
 /**
  * Fills an array with a value.
  * @param n     Length of the array
@@ -37,14 +52,14 @@ void array_init(fixedgrid_t* G, unsigned int n, real_t *array, real_t val)
 {
     int i;
     
-    timer_start(&G->metrics.array_init);
+    timer_start(&G->metrics, "Array Init");
     
     for(i=0; i<n; i++)
     {
         array[i] = val;
     }
     
-    timer_stop(&G->metrics.array_init);
+    timer_stop(&G->metrics, "Array Init");
 }
 
 /**
@@ -52,6 +67,10 @@ void array_init(fixedgrid_t* G, unsigned int n, real_t *array, real_t val)
  */
 void process_emissions(fixedgrid_t* G)
 {
+    /* Synthetic scenarios emit every timestep */
+    if(G->scen.kind != SCENARIO_UNIFORM)
+        return;
+    
     /* Add O3 plume */
     G->conc(SOURCE_X, SOURCE_Y, SOURCE_Z, ind_O3) += SOURCE_RATE / (DX * DY * DZ);
 }
@@ -64,11 +83,9 @@ void init_model(fixedgrid_t* G)
     uint32_t i;
     uint32_t x, y, z, s;
     
-    /* Chemistry buffer */
-    real_t chemBuff[NSPEC];
+    /* Chemistry buffer (the mechanism is always double precision) */
+    double chemBuff[NSPEC];
     
-    metrics_init(&G->metrics, "Serial");
-        
     /* Initialize time frame */
     /* FIXME: year is ignored */
     G->tstart = day2sec(START_DOY) + hour2sec(START_HOUR) + minute2sec(START_MIN);
@@ -76,9 +93,34 @@ void init_model(fixedgrid_t* G)
     G->dt = STEP_SIZE;
     G->time = G->tstart;
     
+    /* Met fields are static unless a synthetic scenario is chosen */
+    G->met_update = FALSE;
+    
+    /* Initialize operator splitting */
+    split_init(G);
+    
+    /* Initialize integrator statistics */
+    chem_init(G);
+    
+    /* Initialize chemistry load balancer */
+    chem_sched_init(G);
+    
+    /* Initialize multi-rate chemistry */
+    chem_rate_init(G);
+    
+    /* Initialize unsplit transport */
+    unsplit_init(G);
+    
+    /* Initialize roofline work counts */
+    roofline_init(G);
+    
+    /* Initialize stability controller */
+    cfl_init(G);
+    G->steps = 0;
+    
     /* Initialize chemistry and concentration data */
     printf("Loading chemistry and concentration data... ");
-    timer_start(&G->metrics.array_init);
+    timer_start(&G->metrics, "Array Init");
     
 #if DO_CHEMISTRY == 1
     
@@ -127,7 +169,7 @@ void init_model(fixedgrid_t* G)
     
 #endif
     
-    timer_stop(&G->metrics.array_init);
+    timer_stop(&G->metrics, "Array Init");
     printf("done.\n");
     
     /* Initialize wind field */
@@ -147,17 +189,30 @@ void init_model(fixedgrid_t* G)
     printf("Loading temperature field data...");
     array_init(G, NX*NY*NZ, &G->temp(0,0,0), TEMP_INIT);
     printf(" done.\n");
+    
+    /* Replace the uniform fields with a synthetic scenario */
+    scenario_init(G);
+    
+    /* Courant and diffusion numbers of the initial fields */
+    cfl_measure(G);
 }
 
 
 /**
  * Displays emission source locations and rates
  */
-void print_emission_sources()
+void print_emission_sources(fixedgrid_t* G)
 {
     printf("\n");
-    printf("Emission sources (SPEC, X, Y, Z, RATE):\n");
-    printf("    (%s, %f, %f, %f, %E)\n", SPC_NAMES[ind_O3], (DX*SOURCE_X + DX*0.5), (DY*SOURCE_Y + DY*0.5), 0.0, SOURCE_RATE);
+    if(G->scen.kind != SCENARIO_UNIFORM)
+    {
+        print_scenario_sources(G);
+    }
+    else
+    {
+        printf("Emission sources (SPEC, X, Y, Z, RATE):\n");
+        printf("    (%s, %f, %f, %f, %E)\n", SPC_NAMES[ind_O3], (DX*SOURCE_X + DX*0.5), (DY*SOURCE_Y + DY*0.5), 0.0, SOURCE_RATE);
+    }
     printf("\n");
 }
 
@@ -177,7 +232,27 @@ void print_start_banner(fixedgrid_t* G)
     printf("    Y DISCRETIZATION:   %s\n", DO_Y_DISCRET == TRUE ? "TRUE" : "FALSE");
     printf("    Z DISCRETIZATION:   %s\n", DO_Z_DISCRET == TRUE ? "TRUE" : "FALSE");
     printf("    SAPRC99 CHEMISTRY:  %s\n", DO_CHEMISTRY == TRUE ? "TRUE" : "FALSE");
-    printf("    DOUBLE PRECISION:   %s\n", DOUBLE_PRECISION == TRUE ? "TRUE" : "FALSE");
+    printf("    CHEM MIXED LU:      %s\n", CHEM_MIXED_LU == TRUE ? "TRUE" : "FALSE");
+    printf("    CHEM DARK KERNELS:  %s\n", CHEM_DARK_KERNELS == TRUE ? "TRUE" : "FALSE");
+    printf("    CHEM FUSED FUNJAC:  %s\n", CHEM_FUSED_FUNJAC == TRUE ? "TRUE" : "FALSE");
+    printf("    CHEM ANALYTIC DFDT: %s\n", CHEM_ANALYTIC_DFDT == TRUE ? "TRUE" : "FALSE");
+    printf("    CHEM COST MAP:      %s\n", CHEM_COST_MAP == TRUE ? "TRUE" : "FALSE");
+    if(CHEM_STRIDE == 0)
+        printf("    CHEM STRIDE:        ADAPTIVE (at most %d)\n", CHEM_STRIDE_MAX);
+    else
+        printf("    CHEM STRIDE:        %d\n", CHEM_STRIDE);
+    printf("    MERGE HALF STEPS:   %s\n", MERGE_HALF_STEPS == TRUE ? "TRUE" : "FALSE");
+    printf("    ADAPTIVE STEP:      %s\n", ADAPTIVE_STEP == TRUE ? "TRUE" : "FALSE");
+    printf("    IMPLICIT Z DIFF:    %s\n", IMPLICIT_Z_DIFFUSION == TRUE ? "TRUE" : "FALSE");
+    printf("    PLANE PIPELINE:     %s\n", PLANE_PIPELINE == TRUE ? "TRUE" : "FALSE");
+    printf("    TRANSPORT ENGINE:   %s\n", G->unsplit.enabled ? "UNSPLIT" : "SPLIT");
+    if(G->scen.kind != SCENARIO_UNIFORM)
+        printf("    SCENARIO:           %s (seed %u, %d sources)\n", scenario_name(G->scen.kind), G->scen.seed, SCENARIO_SOURCES);
+    else
+        printf("    SCENARIO:           %s\n", scenario_name(G->scen.kind));
+    printf("    HW COUNTERS:        %s\n", HW_COUNTERS == TRUE ? "TRUE" : "FALSE");
+    printf("    DOUBLE PRECISION:   %s\n", DOUBLE_PRECISION == TRUE ? "TRUE" : "FALSE (MIXED)");
+    printf("    FIELD STORAGE:      %.1f MB\n", sizeof(fixedgrid_t) / 1.0e6);
     printf("\n");
     printf("SPACE DOMAIN:\n");
     printf("    LENGTH (X): %f meters\n", NX*DX);
@@ -187,8 +262,14 @@ void print_start_banner(fixedgrid_t* G)
     printf("TIME DOMAIN:\n");
     printf("    FROM  %d:%d.00 on day %d of year %d\n", START_HOUR, START_MIN, START_DOY, START_YEAR);
     printf("    TO    %d:%d.00 on day %d of year %d\n", END_HOUR, END_MIN, END_DOY, END_YEAR);
+#if ADAPTIVE_STEP == 1
+    printf("    TOTAL %d seconds (adaptive timesteps of at most %d seconds)\n", (int)(G->tend-G->tstart), (int)STEP_SIZE_MAX);
+#else
     printf("    TOTAL %d seconds (%d timesteps of %d seconds)\n", (int)(G->tend-G->tstart), steps, (int)G->dt);
+#endif
     printf("\n");
+    print_cfl(G);
+    print_traffic(G);
     printf("CHEMICAL SPECIES:\n");
     printf("    TOTAL:    %d\n", NSPEC);
     printf("    EXAMINED: ");
@@ -204,11 +285,20 @@ void print_start_banner(fixedgrid_t* G)
     }
     printf("%s\n", SPC_NAMES[ MONITOR[NMONITOR-1] ]);
     
-    print_emission_sources();
+    print_emission_sources(G);
     
     printf("\n");
 }
 
+/**
+ * Counts hardware events in and traces the timer called name
+ */
+void watch_phase(char* name)
+{
+    hwc_watch(name);
+    trace_watch(name);
+}
+
 /**
  * Program entry point.
  */
@@ -220,38 +310,124 @@ int main(int argc, char** argv)
     /* Iterators */
     int i, iter;
     
+    /* Requested number of threads */
+    int nthreads;
+    
+    /* TRUE if chemistry runs this step */
+    bool run_chem;
+    
+    /* TRUE to write a timeline of the run */
+    bool trace = FALSE;
+    
+    /* TRUE to sample the cells chemistry integrates */
+    bool capture = FALSE;
+    
     /* Start wall clock timer */
-    timer_start(&G->metrics.wallclock);
+    metrics_init(&G->metrics, "Serial");
+    timer_start(&G->metrics, "Wallclock");
 
     G->nprocs = omp_get_max_threads();
 
+    /* Default transport engine */
+    G->unsplit.enabled = UNSPLIT_TRANSPORT;
+
+    /* Default scenario */
+    G->scen.kind = SCENARIO;
+    G->scen.seed = SCENARIO_SEED;
+
     /* Parse command line arguments */
-    if(argc > 1)
+    for(i=1; i<argc; i++)
     {
-        i = atoi(argv[1]);
-        if(i < 1)
+        if(argv[i][0] == '-')
+        {
+            if(!strcmp(argv[i], "-split"))
+            {
+                G->unsplit.enabled = FALSE;
+            }
+            else if(!strcmp(argv[i], "-unsplit"))
+            {
+                G->unsplit.enabled = TRUE;
+            }
+            else if(!strcmp(argv[i], "-trace"))
+            {
+                trace = TRUE;
+            }
+            else if(!strcmp(argv[i], "-capture"))
+            {
+                capture = TRUE;
+            }
+            else if(!strcmp(argv[i], "-roofline"))
+            {
+                G->roof.enabled = TRUE;
+            }
+            else if(!strcmp(argv[i], "-scenario") && i+1 < argc)
+            {
+                G->scen.kind = atoi(argv[++i]);
+                if(G->scen.kind < SCENARIO_UNIFORM || G->scen.kind > SCENARIO_SHEAR)
+                {
+                    fprintf(stderr, "Invalid scenario: %d (0 uniform, 1 rotating, 2 shear).\n", G->scen.kind);
+                    exit(1);
+                }
+            }
+            else if(!strcmp(argv[i], "-seed") && i+1 < argc)
+            {
+                G->scen.seed = strtoul(argv[++i], NULL, 10);
+            }
+            else
+            {
+                fprintf(stderr, "Unknown option: %s\n", argv[i]);
+                fprintf(stderr, "Usage: %s [threads] [-split | -unsplit] [-trace] [-capture] [-roofline] [-scenario n] [-seed n]\n", argv[0]);
+                exit(1);
+            }
+            continue;
+        }
+
+        nthreads = atoi(argv[i]);
+        if(nthreads < 1)
         {
-            fprintf(stderr, "Invalid number of threads: %d < 1.\n", i);
+            fprintf(stderr, "Invalid number of threads: %d < 1.\n", nthreads);
             exit(1);
         }
 
-        if(i <= G->nprocs)
+        if(nthreads <= G->nprocs)
         {
-            G->nprocs = i;
+            G->nprocs = nthreads;
         }
         else
         {
-            printf("%d threads unavailable.  Using %d instead.\n", i, G->nprocs);
+            printf("%d threads unavailable.  Using %d instead.\n", nthreads, G->nprocs);
         }
     }
 
     printf("\nRunning on %d threads\n", G->nprocs);
 
     omp_set_num_threads(G->nprocs);
+
+    /* Count hardware events and trace each phase */
+    hwc_init(G->nprocs);
+    if(trace)
+        trace_init(G->nprocs);
+    watch_phase("X discret");
+    watch_phase("Y discret");
+    watch_phase("Z discret");
+    watch_phase("Unsplit");
+    watch_phase("Planes");
+    watch_phase("Chemistry");
+    watch_phase("File I/O");
     
     /* Initialize the model parameters */
     init_model(G);
     
+    /* Sample chemistry cells for bench_replay.
+     * saprc99_chem_row integrates with Rodas4 (method 5). */
+    if(capture)
+    {
+        if(DO_CHEMISTRY == 1)
+            capture_open(G->nprocs, 5, CHEM_MIXED_LU);
+        else
+            printf("Chemistry capture needs DO_CHEMISTRY 1.\n");
+    }
+    
     /* Add emissions */
     process_emissions(G);
     
@@ -266,60 +442,88 @@ int main(int argc, char** argv)
     /* BEGIN CALCULATIONS */
     for(iter=1, G->time = G->tstart; G->time < G->tend; G->time += G->dt, ++iter)
     {
-        /* Chemistry */
-        saprc99_chem(G);
+        trace_step = iter;
+        trace_begin("Step");
         
-	#pragma omp parallel shared(G, iter)
-	{
-		discretize_all_x(G, G->dt*0.5);
-
-		discretize_all_y(G, G->dt*0.5);
-		
-		discretize_all_z(G, G->dt);
-		
-		discretize_all_y(G, G->dt*05);
-		
-		discretize_all_x(G, G->dt*05);
-	}
-		
-        /*
-         * Could update wind field here...
-         */
-         
-        /*
-         * Could update diffusion tensor here...
-         */
-         
-        /*
-         * Could update environment here...
-         */
+        /* Choose a stable timestep */
+        cfl_update(G);
+        
+        /* Chemistry runs every G->chem_rate.stride steps */
+        run_chem = chem_rate_begin(G);
+        
+        if(PLANE_PIPELINE && !G->unsplit.enabled)
+        {
+            /* Chemistry and horizontal transport by plane, then z */
+            pipeline_step(G, run_chem);
+        }
+        else
+        {
+            /* Chemistry */
+            if(run_chem)
+                saprc99_chem(G);
+            
+            /* Transport */
+            if(G->unsplit.enabled)
+                unsplit_step(G);
+            else
+                split_step(G, split_need_sync(G));
+        }
+        
+        chem_rate_end(G);
+        
+        /* Emissions and met fields of a synthetic scenario */
+        scenario_update(G);
         
         /* Store concentration */
         #if WRITE_EACH_ITER == 1
         write_conc(G, iter, 0);
         #endif
         
+        trace_end();
+        
         /* Indicate progress */
-        printf("  After iteration %02d: Model time = %07.2f sec.\n", iter, iter*G->dt);
+        printf("  After iteration %02d: Model time = %07.2f sec.\n", iter, G->time+G->dt-G->tstart);
     }
     /* END CALCULATIONS */
     
+    G->steps = iter-1;
+    
+    /* Complete any deferred half-step */
+    split_flush(G);
+    
     /* Store concentration */
     #if WRITE_EACH_ITER != 1
     write_conc(G, iter-1, 0);
     #endif
     
     /* Show final time */
-    printf("Final time: %f seconds.\n", (iter-1)*G->dt);
-    
-    timer_stop(&G->metrics.wallclock);
+    printf("Final time: %f seconds.\n", G->time-G->tstart);
+    printf("Timesteps: %d (%.2f to %.2f seconds)\n", G->steps, G->cfl.dt_min, G->cfl.dt_max);
+    if(G->unsplit.enabled)
+        printf("Transport passes: %d (unsplit)\n", G->unsplit.passes);
+    else
+        printf("Transport sweeps: %d (%d half-step pairs merged)\n", G->split.sweeps, G->split.fused);
+    print_chem_rate(G);
+    print_chem_stats(G);
+    print_chem_sched(G);
+    
+    timer_stop(&G->metrics, "Wallclock");
     
     /* Print metrics */
     print_metrics(&G->metrics);
+    print_hwc(NX*NY*NZ);
+    print_chem_cost(G);
+    print_roofline(G);
     
     /* Write metrics to CSV file */
     write_metrics_as_csv(G, "Serial");
     
+    /* Write the timeline */
+    write_trace(G->nprocs);
+    
+    /* Complete the chemistry samples */
+    capture_close();
+    
     /* Cleanup and exit */
     return 0;
 }
@@ -25,13 +25,50 @@
 #define TRUE  1
 #define FALSE 0
 
-#define conc(x, y, z, s) __conc[s][z][y][x]
+/* Transport axes */
+#define X_AXIS 0
+#define Y_AXIS 1
+#define Z_AXIS 2
+
+/* Concentration layouts (see CONC_LAYOUT in params.h) */
+#define LAYOUT_SPECIES_OUTER 0
+#define LAYOUT_CELL_OUTER    1
+#define LAYOUT_BLOCKED       2
+
+/* Number of x-blocks in the blocked layout */
+#define CONC_NXB ((NX + CONC_XLANE - 1) / CONC_XLANE)
+
+#if CONC_LAYOUT == LAYOUT_SPECIES_OUTER
+/* [s][z][y][x]: x-rows of one species are contiguous */
+#define CONC_SIZE (NSPEC*NZ*NY*NX)
+#define CONC_INDEX(x, y, z, s) \
+    ((((s)*NZ + (z))*NY + (y))*NX + (x))
+#elif CONC_LAYOUT == LAYOUT_CELL_OUTER
+/* [z][y][x][s]: all species of one cell are contiguous */
+#define CONC_SIZE (NZ*NY*NX*NSPEC)
+#define CONC_INDEX(x, y, z, s) \
+    ((((z)*NY + (y))*NX + (x))*NSPEC + (s))
+#elif CONC_LAYOUT == LAYOUT_BLOCKED
+/* [z][y][xblock][s][xlane]: CONC_XLANE cells of one species are contiguous */
+#define CONC_SIZE (NZ*NY*CONC_NXB*NSPEC*CONC_XLANE)
+#define CONC_INDEX(x, y, z, s) \
+    (((((z)*NY + (y))*CONC_NXB + (x)/CONC_XLANE)*NSPEC + (s))*CONC_XLANE + (x)%CONC_XLANE)
+#else
+#error "Unknown CONC_LAYOUT"
+#endif
+
+#define conc(x, y, z, s) __conc[CONC_INDEX(x, y, z, s)]
 #define wind_u(x, y, z)  __wind_u[z][y][x]
 #define wind_v(x, y, z)  __wind_v[z][y][x]
 #define wind_w(x, y, z)  __wind_w[z][y][x]
 #define diff_h(x, y, z)  __diff_h[z][y][x]
 #define diff_v(x, y, z)  __diff_v[z][y][x]
 #define   temp(x, y, z)    __temp[z][y][x]
+#define hstart(x, y, z)  __hstart[z][y][x]
+#define   cost(x, y, z)    __cost[z][y][x]
+#define cost_nstp(x, y, z) __cost_nstp[z][y][x]
+#define cost_nrej(x, y, z) __cost_nrej[z][y][x]
+#define cost_usec(x, y, z) __cost_usec[z][y][x]
 
 /**************************************************
  * Data types                                     *
@@ -39,11 +76,162 @@
 
 typedef short bool;
 
+/* Operator splitting scheduler state */
+typedef struct split_sched
+{
+    /* Trailing x half-step deferred to the next timestep (sec) */
+    real_t x_pending;
+    
+    /* Transport sweeps issued */
+    uint32_t sweeps;
+    
+    /* Half-step pairs merged into a single sweep */
+    uint32_t fused;
+    
+} split_sched_t;
+
+/* Unsplit transport engine state */
+typedef struct unsplit
+{
+    /* TRUE to use the unsplit engine instead of Strang splitting */
+    bool enabled;
+    
+    /* First-stage concentrations [NLOOKAT][NZ][NY][NX] */
+    real_t *stage;
+    
+    /* Row of zeros for vertical diffusion handled implicitly */
+    real_t *zero;
+    
+    /* Stencil passes issued */
+    uint32_t passes;
+    
+} unsplit_t;
+
+/* Transport stability (CFL) controller state */
+typedef struct cfl
+{
+    /* Largest |wind| / cell size on each axis (1/sec) */
+    real_t adv_rate[3];
+    
+    /* Largest diffusion / cell size^2 on each axis (1/sec) */
+    real_t diff_rate[3];
+    
+    /* Largest stable sweep length on each axis (sec) */
+    real_t dt_stable[3];
+    
+    /* Smallest and largest timestep taken (sec) */
+    real_t dt_min;
+    real_t dt_max;
+    
+    /* TRUE if the rates must be recomputed */
+    bool stale;
+    
+} cfl_t;
+
+/* Multi-rate chemistry scheduler state */
+typedef struct chem_rate
+{
+    /* Transport steps covered by the current chemistry step */
+    uint32_t stride;
+    
+    /* Transport steps left in the current chemistry step */
+    uint32_t left;
+    
+    /* Time covered by the current chemistry step (sec) */
+    real_t dt;
+    
+    /* Chemistry steps taken */
+    uint32_t calls;
+    
+    /* Largest stride used */
+    uint32_t max_stride;
+    
+} chem_rate_t;
+
+/* Chemistry load balancer state */
+typedef struct chem_sched
+{
+    /* Threads the partitions are allocated for */
+    uint32_t nthreads;
+    
+    /* Rows (z*NY + y) of thread t are bounds[t] .. bounds[t+1]-1 */
+    int32_t *bounds;
+    
+    /* Next unclaimed row of each partition, padded to a cache line */
+    int32_t *next;
+    
+    /* Time each thread spent integrating and waiting (sec) */
+    double *busy;
+    double *idle;
+    
+    /* Rows integrated by a thread other than their owner */
+    uint64_t stolen;
+    
+} chem_sched_t;
+
+/* Work counts for the roofline report */
+typedef struct roofline
+{
+    /* TRUE to report achieved rates against memory bandwidth */
+    bool enabled;
+    
+    /* Cell updates of one species by the split sweeps
+     * of each axis, substeps included */
+    uint64_t sweep[3];
+    
+    /* Cell updates by the x and y sweeps of the plane pipeline */
+    uint64_t plane;
+    
+    /* Measured memory bandwidth (GB/s), 0 until measured */
+    double stream;
+    
+} roofline_t;
+
+/* Random phases of the horizontal diffusivity */
+#define SCENARIO_MODES 3
+
+/* One emission source of the synthetic scenario */
+typedef struct scenario_source
+{
+    /* Cell and species */
+    int32_t x, y, z, s;
+    
+    /* Peak emission rate (molecules/cm^3/s) */
+    real_t rate;
+    
+    /* Diurnal profile (SOURCE_CONSTANT, SOURCE_TRAFFIC or SOURCE_SOLAR) */
+    int32_t profile;
+    
+} scenario_source_t;
+
+/* Synthetic scenario state */
+typedef struct scenario
+{
+    /* Scenario (SCENARIO in params.h), 0 for the uniform fields */
+    int32_t kind;
+    
+    /* Seed of the random phases and sources */
+    uint32_t seed;
+    
+    /* Emission sources */
+    scenario_source_t src[SCENARIO_SOURCES];
+    
+    /* Separable shapes of the fields along x, y and z */
+    real_t ax[NX], bx[NX];
+    real_t ay[NY], by[NY];
+    real_t pz[NZ], kz[NZ];
+    
+    /* Random-phase modes of the horizontal diffusivity */
+    real_t mx[SCENARIO_MODES][NX];
+    real_t my[SCENARIO_MODES][NY];
+    
+} scenario_t;
+
 /* Program state (global variables) */
 typedef struct fixedgrid
 {
     /* Concentration field */
-    real_t __conc[NSPEC][NZ][NY][NX];
+    real_t __conc[CONC_SIZE];
     
     /* Wind vector field */
     real_t __wind_u[NZ][NY][NX];
@@ -57,12 +245,60 @@ typedef struct fixedgrid
     /* Temperature field */
     real_t __temp[NZ][NY][NX];
     
+#if DO_CHEMISTRY == 1
+    /* Last accepted chemistry step in each cell (sec), 0 if none yet */
+    float __hstart[NZ][NY][NX];
+    
+    /* Integrator steps in each cell at the last chemistry call */
+    uint16_t __cost[NZ][NY][NX];
+    
+#if CHEM_COST_MAP == 1
+    /* Integrator steps, rejected steps and microseconds
+     * in each cell, summed over all chemistry calls */
+    uint32_t __cost_nstp[NZ][NY][NX];
+    uint32_t __cost_nrej[NZ][NY][NX];
+    uint32_t __cost_usec[NZ][NY][NX];
+#endif
+#endif
+    
     /* Time (seconds) */
     real_t time;
     real_t tstart;
     real_t tend;
     real_t dt;
     
+    /* TRUE if met fields change between timesteps */
+    bool met_update;
+    
+    /* Timesteps taken */
+    uint32_t steps;
+    
+    /* Operator splitting */
+    split_sched_t split;
+    
+    /* Unsplit transport */
+    unsplit_t unsplit;
+    
+    /* Transport stability */
+    cfl_t cfl;
+    
+    /* Chemistry load balancer */
+    chem_sched_t sched;
+    
+    /* Multi-rate chemistry */
+    chem_rate_t chem_rate;
+    
+    /* Roofline work counts */
+    roofline_t roof;
+    
+    /* Synthetic scenario */
+    scenario_t scen;
+    
+    /* Integrator statistics summed over all cells
+     * (Nfun, Njac, Nstp, Nacc, Nrej, Ndec, Nsol, Nsng, then the
+     * Fun and Jac_SP calls made by the dark kernels and the Fun_Photo calls) */
+    uint64_t chem_stats[11];
+    
     /* Parallelization */
     /* This is always == 1 for serial code */
     uint32_t nprocs;
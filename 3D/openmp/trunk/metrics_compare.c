@@ -0,0 +1,288 @@
+/*
+ *  metrics_compare.c
+ *
+ *  Compares the timers of fixedgrid runs against a baseline.
+ *
+ *  Reads the METRICS_<RUN_ID>_<nprocs>.csv files of one or more
+ *  baseline runs and one or more new runs, normalizes each timer to
+ *  nanoseconds per cell per timestep, and averages the runs of each
+ *  side.  The spread of repeated runs estimates the noise: a timer
+ *  regresses if it is slower than the baseline by more than the
+ *  threshold and by more than sigma times the standard error of the
+ *  difference.  A few runs can agree by chance, so no timer's
+ *  deviation is taken as less than a fixed share of its mean
+ *  (-noise), which is also all a single run has.  Only the wallclock and the phases directly under it can
+ *  fail; timers nested inside a phase and timers taking less than a
+ *  minimum share of the baseline wallclock are listed but never fail.
+ *
+ *  usage: metrics_compare [-threshold pct] [-sigma k] [-min pct] [-noise pct]
+ *                         baseline.csv [...] -- new.csv [...]
+ *
+ *  Exits with 0 if nothing regressed, 1 if a timer regressed,
+ *  and 2 if the files can't be read.
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* Most timers and runs per side */
+#define MAX_TIMERS 64
+#define MAX_RUNS   64
+
+/* Longest timer path */
+#define PATH_LEN   256
+
+/* Timers of one side (baseline or new), one column per run */
+typedef struct side
+{
+    int nruns;
+    int ntimers;
+    char path[MAX_TIMERS][PATH_LEN];
+    int depth[MAX_TIMERS];
+    double ns[MAX_TIMERS][MAX_RUNS];    /* ns per cell per step, <0 if missing */
+    long cells;
+    int nprocs;
+} side_t;
+
+/**
+ * Returns the timer called path, adding it if needed
+ */
+static int find_timer(side_t* s, char* path, int depth)
+{
+    int i, r;
+
+    for(i=0; i<s->ntimers; i++)
+        if(!strcmp(s->path[i], path))
+            return i;
+
+    if(s->ntimers >= MAX_TIMERS)
+        return -1;
+
+    i = s->ntimers++;
+    snprintf(s->path[i], PATH_LEN, "%s", path);
+    s->depth[i] = depth;
+    for(r=0; r<MAX_RUNS; r++)
+        s->ns[i][r] = -1.0;
+
+    return i;
+}
+
+/**
+ * Reads one metrics file as the next run of a side.
+ * Returns 0 on success.
+ */
+static int read_metrics(side_t* s, char* fname)
+{
+    FILE* fptr;
+    char line[1024];
+    char path[PATH_LEN];
+    long nx = 0, ny = 0, nz = 0, steps = 0, cells;
+    int nprocs = 0, depth, timers = 0, i, run;
+    unsigned long calls;
+    double total;
+
+    if(s->nruns >= MAX_RUNS)
+    {
+        fprintf(stderr, "Too many runs (MAX_RUNS %d): %s ignored.\n", MAX_RUNS, fname);
+        return 0;
+    }
+
+    if((fptr = fopen(fname, "r")) == NULL)
+    {
+        fprintf(stderr, "Couldn't open file \"%s\" for reading.\n", fname);
+        return 1;
+    }
+
+    /* Header first, so the timers can be normalized as they are read */
+    while(fgets(line, sizeof(line), fptr))
+    {
+        sscanf(line, "NPROCS:,%d", &nprocs);
+        sscanf(line, "NX:,%ld", &nx);
+        sscanf(line, "NY:,%ld", &ny);
+        sscanf(line, "NZ:,%ld", &nz);
+        sscanf(line, "Steps:,%ld", &steps);
+        if(!strncmp(line, "Path,Depth,Calls,Total", 22))
+            break;
+    }
+
+    cells = nx*ny*nz;
+    if(cells <= 0 || steps <= 0)
+    {
+        fprintf(stderr, "%s has no grid size or step count.\n", fname);
+        fclose(fptr);
+        return 1;
+    }
+
+    if(s->nruns > 0 && (cells != s->cells || nprocs != s->nprocs))
+        fprintf(stderr, "Warning: %s ran %ld cells on %d threads, not %ld on %d.\n",
+                fname, cells, nprocs, s->cells, s->nprocs);
+    s->cells = cells;
+    s->nprocs = nprocs;
+
+    run = s->nruns;
+    while(fgets(line, sizeof(line), fptr))
+    {
+        if(sscanf(line, "%255[^,],%d,%lu,%lf", path, &depth, &calls, &total) != 4)
+            break;
+        if((i = find_timer(s, path, depth)) < 0)
+            continue;
+        s->ns[i][run] = total / (cells * (double)steps) * 1.0e9;
+        ++timers;
+    }
+    fclose(fptr);
+
+    if(timers == 0)
+    {
+        fprintf(stderr, "%s has no timers.\n", fname);
+        return 1;
+    }
+
+    ++s->nruns;
+    return 0;
+}
+
+/**
+ * Mean and standard deviation of a timer over the runs that have it.
+ * The deviation is at least rel_floor times the mean, which is all
+ * a single run has.
+ * Returns the number of those runs.
+ */
+static int timer_stats(side_t* s, int i, double rel_floor, double* mean, double* sd)
+{
+    int r, n = 0;
+    double sum = 0.0, sq = 0.0;
+
+    for(r=0; r<s->nruns; r++)
+    {
+        if(s->ns[i][r] < 0.0)
+            continue;
+        sum += s->ns[i][r];
+        ++n;
+    }
+    *mean = n > 0 ? sum / n : 0.0;
+
+    for(r=0; r<s->nruns; r++)
+        if(s->ns[i][r] >= 0.0)
+            sq += (s->ns[i][r] - *mean) * (s->ns[i][r] - *mean);
+    *sd = n > 1 ? sqrt(sq / (n - 1)) : 0.0;
+    if(*sd < rel_floor * *mean)
+        *sd = rel_floor * *mean;
+
+    return n;
+}
+
+int main(int argc, char** argv)
+{
+    static side_t base, cand;
+    side_t* s = &base;
+    double threshold = 5.0;
+    double sigma = 2.0;
+    double min_share = 1.0;
+    double noise_floor = 5.0;
+    double bm, bsd, nm, nsd, wall, change, noise;
+    char* status;
+    int i, j, nb, nn, failed = 0, usage = 0;
+
+    for(i=1; i<argc; i++)
+    {
+        if(!strcmp(argv[i], "-threshold") && i+1 < argc)
+            threshold = atof(argv[++i]);
+        else if(!strcmp(argv[i], "-sigma") && i+1 < argc)
+            sigma = atof(argv[++i]);
+        else if(!strcmp(argv[i], "-min") && i+1 < argc)
+            min_share = atof(argv[++i]);
+        else if(!strcmp(argv[i], "-noise") && i+1 < argc)
+            noise_floor = atof(argv[++i]);
+        else if(!strcmp(argv[i], "--") && s == &base)
+            s = &cand;
+        else if(argv[i][0] == '-')
+            usage = 1;
+        else if(read_metrics(s, argv[i]))
+            return 2;
+    }
+
+    if(usage || base.nruns == 0 || cand.nruns == 0)
+    {
+        fprintf(stderr, "usage: %s [-threshold pct] [-sigma k] [-min pct] [-noise pct] baseline.csv [...] -- new.csv [...]\n", argv[0]);
+        return 2;
+    }
+
+    /* Baseline wallclock, for the share of each timer */
+    wall = 0.0;
+    for(i=0; i<base.ntimers; i++)
+        if(!strcmp(base.path[i], "Wallclock"))
+            timer_stats(&base, i, 0.0, &wall, &bsd);
+
+    printf("Baseline: %d run(s), %ld cells, %d threads\n", base.nruns, base.cells, base.nprocs);
+    printf("New:      %d run(s), %ld cells, %d threads\n", cand.nruns, cand.cells, cand.nprocs);
+    printf("Regression: slower by more than %g%% and %g standard errors (noise at least %g%% per run);\n"
+           "timers under %g%% of the wallclock and timers nested inside a phase (marked *) never fail\n",
+           threshold, sigma, noise_floor, min_share);
+    if(base.nruns < 2 || cand.nruns < 2)
+        printf("Warning: a side has only one run, so its noise is taken as %g%% of each timer; "
+               "repeat runs to measure it\n", noise_floor);
+    printf("\n");
+    printf("%-40s %12s %7s %12s %7s %9s  %s\n", "Timer (ns/cell/step)", "Baseline", "+-", "New", "+-", "Change", "Status");
+
+    for(i=0; i<base.ntimers; i++)
+    {
+        nb = timer_stats(&base, i, 0.01*noise_floor, &bm, &bsd);
+        for(j=0; j<cand.ntimers && strcmp(cand.path[j], base.path[i]); j++);
+        if(j == cand.ntimers)
+        {
+            printf("%-40s %12.3f %6.1f%% %12s %7s %9s  missing\n", base.path[i], bm,
+                   bm > 0 ? 100.0*bsd/bm : 0.0, "-", "", "");
+            continue;
+        }
+        nn = timer_stats(&cand, j, 0.01*noise_floor, &nm, &nsd);
+
+        change = bm > 0 ? 100.0 * (nm - bm) / bm : 0.0;
+
+        /* Standard error of the difference of the means */
+        noise = sqrt(bsd*bsd/nb + nsd*nsd/nn);
+
+        if(wall > 0 && bm < 0.01*min_share*wall)
+            status = "minor";
+        else if(change > threshold && nm - bm > sigma*noise)
+        {
+            /* Nested timers are part of their phase's time */
+            if(base.depth[i] > 1)
+                status = "slower";
+            else
+            {
+                status = "REGRESSION";
+                failed = 1;
+            }
+        }
+        else if(change < -threshold && bm - nm > sigma*noise)
+            status = "faster";
+        else if(fabs(change) > threshold)
+            status = "noise";
+        else
+            status = "ok";
+
+        printf("%-40s %12.3f %6.1f%% %12.3f %6.1f%% %+8.1f%%  %s%s\n", base.path[i],
+               bm, bm > 0 ? 100.0*bsd/bm : 0.0, nm, nm > 0 ? 100.0*nsd/nm : 0.0, change, status,
+               base.depth[i] > 1 ? " *" : "");
+    }
+
+    for(j=0; j<cand.ntimers; j++)
+    {
+        for(i=0; i<base.ntimers && strcmp(cand.path[j], base.path[i]); i++);
+        if(i < base.ntimers)
+            continue;
+        timer_stats(&cand, j, 0.01*noise_floor, &nm, &nsd);
+        printf("%-40s %12s %7s %12.3f %6.1f%% %9s  new\n", cand.path[j], "-", "",
+               nm, nm > 0 ? 100.0*nsd/nm : 0.0, "");
+    }
+
+    printf("\n%s\n", failed ? "FAILED: performance regression" : "PASSED");
+
+    return failed;
+}
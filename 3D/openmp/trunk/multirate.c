@@ -0,0 +1,173 @@
+/*
+ *  multirate.c
+ *
+ *  Multi-rate coupling of chemistry and transport.
+ *
+ *  Chemistry is the first operator of a block of k transport steps
+ *  and integrates over all k*dt of them at once, so a block costs
+ *  one chemistry call instead of k.  With CHEM_STRIDE > 0, k is fixed.
+ *  With CHEM_STRIDE 0, k is chosen at the start of each block:
+ *    - every cell records the step its integrator would take next,
+ *      and k may grow (doubling) only while every cell covered the
+ *      whole of the last block in its final step; otherwise k drops
+ *      to the number of transport steps the smallest such step covers,
+ *    - k is cut until SUN changes by at most CHEM_SUN_TOL over the
+ *      block, so photolysis is never integrated across sunrise or
+ *      sunset in one piece,
+ *    - k is at most CHEM_STRIDE_MAX and never runs past the end time.
+ *  While the met fields change between steps, k is 1.
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#include <stdio.h>
+#include <math.h>
+
+#include "multirate.h"
+#include "saprc99_Global.h"
+
+void Update_SUN();
+
+/**
+ * Resets the scheduler
+ */
+void chem_rate_init(fixedgrid_t* G)
+{
+    G->chem_rate.stride = CHEM_STRIDE > 0 ? CHEM_STRIDE : 1;
+    G->chem_rate.left = 0;
+    G->chem_rate.dt = G->dt;
+    G->chem_rate.calls = 0;
+    G->chem_rate.max_stride = 0;
+}
+
+#if DO_CHEMISTRY == 1 && CHEM_STRIDE == 0
+
+/**
+ * Returns the sunlight intensity at time t
+ */
+static double sun_at(double t)
+{
+    double told, sun;
+
+    told = TIME;
+    TIME = t;
+    Update_SUN();
+    sun = SUN;
+    TIME = told;
+
+    return sun;
+}
+
+/**
+ * Chooses the number of transport steps the next chemistry step covers
+ */
+static uint32_t choose_stride(fixedgrid_t* G)
+{
+    int32_t x, y, z;
+    uint32_t k, j;
+    double hmin, s0, s;
+
+    if(G->met_update)
+        return 1;
+
+    /* First block: nothing is known about the integrator yet */
+    if(G->chem_rate.calls == 0)
+        return 1;
+
+    /* Smallest step any cell would take next */
+    hmin = G->chem_rate.dt;
+    for(z=0; z<NZ; z++)
+        for(y=0; y<NY; y++)
+            for(x=0; x<NX; x++)
+                if(G->hstart(x, y, z) < hmin)
+                    hmin = G->hstart(x, y, z);
+
+    /* Steps are capped at the block length, so a cell that
+     * reached it may be able to go further */
+    if(hmin >= G->chem_rate.dt * (1.0 - 1.0e-6))
+        k = 2*G->chem_rate.stride;
+    else
+        k = (uint32_t)(hmin / G->dt);
+
+    if(k < 1) k = 1;
+    if(k > CHEM_STRIDE_MAX) k = CHEM_STRIDE_MAX;
+
+    /* Keep the change in sunlight over the block small */
+    s0 = sun_at(G->time);
+    for(j=1; j<=k; j++)
+    {
+        s = sun_at(G->time + j*G->dt);
+        if(fabs(s - s0) > CHEM_SUN_TOL)
+        {
+            k = j > 1 ? j-1 : 1;
+            break;
+        }
+    }
+
+    return k;
+}
+
+#endif
+
+/**
+ * Starts a transport step.  Returns TRUE if chemistry
+ * runs this step, in which case G->chem_rate.dt is the
+ * time it covers.
+ */
+bool chem_rate_begin(fixedgrid_t* G)
+{
+    uint32_t k, steps_left;
+
+    if(G->chem_rate.left > 0)
+        return FALSE;
+
+#if DO_CHEMISTRY == 1 && CHEM_STRIDE == 0
+    k = choose_stride(G);
+#else
+    k = G->chem_rate.stride;
+#endif
+
+    /* Don't run past the end time */
+    steps_left = (uint32_t)ceil((G->tend - G->time) / G->dt - 1.0e-6);
+    if(k > steps_left) k = steps_left;
+    if(k < 1) k = 1;
+
+    G->chem_rate.stride = k;
+    G->chem_rate.left = k;
+    G->chem_rate.dt = k*G->dt;
+    ++G->chem_rate.calls;
+    if(k > G->chem_rate.max_stride) G->chem_rate.max_stride = k;
+
+    return TRUE;
+}
+
+/**
+ * Finishes a transport step
+ */
+void chem_rate_end(fixedgrid_t* G)
+{
+    if(G->chem_rate.left > 0)
+        --G->chem_rate.left;
+}
+
+/**
+ * Returns TRUE if chemistry runs at the start of the next step
+ */
+bool chem_rate_due(fixedgrid_t* G)
+{
+    return G->chem_rate.left <= 1;
+}
+
+/**
+ * Displays the number of chemistry steps taken
+ */
+void print_chem_rate(fixedgrid_t* G)
+{
+#if DO_CHEMISTRY == 1
+    printf("Chemistry steps: %d for %d transport steps (%s stride, longest %d transport steps)\n",
+           G->chem_rate.calls, G->steps,
+           CHEM_STRIDE == 0 ? "adaptive" : "fixed", G->chem_rate.max_stride);
+#endif
+}
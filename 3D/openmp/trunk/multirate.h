@@ -0,0 +1,39 @@
+/*
+ *  multirate.h
+ *
+ *  Multi-rate coupling of chemistry and transport.
+ *  Runs chemistry once every few transport steps, over the
+ *  time those steps cover, with the number of steps chosen
+ *  statically (CHEM_STRIDE) or from the integrator's step
+ *  sizes and the change in sunlight.
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#ifndef __MULTIRATE_H__
+#define __MULTIRATE_H__
+
+/**************************************************
+ * Includes                                       *
+ **************************************************/
+
+#include "fixedgrid.h"
+#include "params.h"
+
+/**************************************************
+ * Function prototypes                            *
+ **************************************************/
+
+void chem_rate_init(fixedgrid_t* G);
+
+bool chem_rate_begin(fixedgrid_t* G);
+
+void chem_rate_end(fixedgrid_t* G);
+
+bool chem_rate_due(fixedgrid_t* G);
+
+void print_chem_rate(fixedgrid_t* G);
+
+#endif
@@ -0,0 +1,120 @@
+/*
+ *  pipeline.c
+ *
+ *  Plane pipeline.
+ *
+ *  Chemistry is pointwise and the x and y sweeps only couple cells
+ *  within a z-plane, so each timestep is split as
+ *      for each plane:  y(dt/2)  [ x(dt/2) chem(dt) x(dt/2) per row ]  y(dt/2)
+ *      then:            z(dt)
+ *  Every plane is read from memory once for chemistry and all four
+ *  horizontal sweeps instead of once per operator.
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#include <stdio.h>
+
+#include "pipeline.h"
+#include "transport.h"
+#include "chemistry.h"
+#include "splitting.h"
+#include "saprc99_Global.h"
+#include "trace.h"
+#include "roofline.h"
+
+/**
+ * Advances chemistry and transport by one timestep.
+ * Chemistry is skipped unless run_chem is TRUE.
+ */
+void pipeline_step(fixedgrid_t* G, bool run_chem)
+{
+    int32_t x, y, z;
+    uint64_t n;
+    real_t half;
+    
+    half = G->dt*0.5;
+    
+    timer_start(&G->metrics, "Planes");
+    
+#if DO_CHEMISTRY == 1
+    #pragma omp parallel shared(G, half, run_chem) private(x, y, z, n) copyin(RCONST)
+#else
+    #pragma omp parallel shared(G, half, run_chem) private(x, y, z, n)
+#endif
+    {
+        n = 0;
+        
+        #pragma omp for schedule(dynamic) nowait
+        for(z=0; z<NZ; z++)
+        {
+            trace_begin("Plane");
+            
+            for(x=0; x<NX; x++)
+                n += discretize_col_y(G, x, z, half);
+            
+            for(y=0; y<NY; y++)
+            {
+                n += discretize_row_x(G, y, z, half);
+                if(run_chem)
+                    saprc99_chem_row(G, y, z);
+                n += discretize_row_x(G, y, z, half);
+            }
+            
+            for(x=0; x<NX; x++)
+                n += discretize_col_y(G, x, z, half);
+            
+            trace_end();
+        }
+        
+        roofline_plane(G, n);
+        
+        trace_barrier();
+        
+        discretize_all_z(G, G->dt);
+    }
+    
+    timer_stop(&G->metrics, "Planes");
+    
+    G->split.sweeps += 5;
+}
+
+/**
+ * Displays a model of the memory traffic of one timestep
+ * with and without the plane pipeline.  Each pass over a
+ * field is assumed to read and write it from memory once.
+ */
+void print_traffic(fixedgrid_t* G)
+{
+    double cells, spec, look, met;
+    double chem, sweep, split, planes, plane_set;
+    int x_sweeps;
+    
+    cells = (double)NX*NY*NZ*sizeof(real_t);
+    spec = NSPEC*cells;
+    look = NLOOKAT*cells;
+    met = cells;
+    
+    /* Chemistry reads and writes every species and reads temperature */
+    chem = DO_CHEMISTRY == 1 ? 2.0*spec + met : 0.0;
+    
+    /* A sweep reads and writes each species and reads wind and diffusion */
+    sweep = 2.0*look + 2.0*met;
+    
+    /* Trailing and leading x half-steps may be merged */
+    x_sweeps = split_need_sync(G) ? 2 : 1;
+    split = chem + (x_sweeps + 3)*sweep;
+    
+    /* Planes: species once, u, v, diff_h (and temperature), then z */
+    planes = (DO_CHEMISTRY == 1 ? 2.0*spec + 4.0*met : 2.0*look + 3.0*met) + sweep;
+    
+    plane_set = (DO_CHEMISTRY == 1 ? spec + 4.0*met : look + 3.0*met) / NZ;
+    
+    printf("MEMORY TRAFFIC (model, per timestep):\n");
+    printf("    SWEEPS:         %.1f MB\n", split / 1.0e6);
+    printf("    PLANE PIPELINE: %.1f MB (%.2fx less)\n", planes / 1.0e6, split / planes);
+    printf("    PLANE SIZE:     %.1f MB\n", plane_set / 1.0e6);
+    printf("\n");
+}
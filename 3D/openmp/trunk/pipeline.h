@@ -0,0 +1,32 @@
+/*
+ *  pipeline.h
+ *
+ *  Plane pipeline.
+ *  Runs chemistry and the x and y transport sweeps one z-plane
+ *  at a time, while the plane is still in cache, leaving the
+ *  z sweep as the only pass over the whole domain.
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#ifndef __PIPELINE_H__
+#define __PIPELINE_H__
+
+/**************************************************
+ * Includes                                       *
+ **************************************************/
+
+#include "fixedgrid.h"
+#include "params.h"
+
+/**************************************************
+ * Function prototypes                            *
+ **************************************************/
+
+void pipeline_step(fixedgrid_t* G, bool run_chem);
+
+void print_traffic(fixedgrid_t* G);
+
+#endif
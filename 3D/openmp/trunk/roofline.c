@@ -0,0 +1,285 @@
+/*
+ *  roofline.c
+ *
+ *  Floating point operations and memory traffic of each phase.
+ *
+ *  The transport sweeps count the cell updates they make, substeps
+ *  included; each costs SWEEP_FLOPS operations and moves
+ *  SWEEP_VALUES values.  Unsplit passes are counted by the engine.
+ *  Chemistry operations are those of Fun, Jac_SP, their dark
+ *  versions, Fun_Photo, KppDecomp, KppSolve and the Jac_SP_Vec of
+ *  mixed precision refinement (chem/gen_opcounts.sh) times the calls
+ *  the integrator made of each.  The vector operations of the
+ *  Rosenbrock stages and the rate coefficient updates are not
+ *  counted.  Chemistry moves each cell's concentrations in
+ *  and out once per call.  Traffic is the data each phase must
+ *  read and write once, so a phase that misses in cache moves more.
+ *
+ *  With -roofline, the rates these imply are printed at the end of
+ *  the run beside the bandwidth of a STREAM-style triad
+ *  (a = b + s*c on three arrays of STREAM_N doubles), so phases
+ *  running near the bandwidth are memory bound and phases far below
+ *  the product of their intensity and the bandwidth are not.
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <omp.h>
+
+#include "roofline.h"
+#include "timer.h"
+
+#if DO_CHEMISTRY == 1
+#include "saprc99_Sparse.h"
+#include "saprc99_OpCounts.h"
+#endif
+
+/* Phases reported */
+#define ROOF_PHASES 6
+
+/* Work and time of one phase */
+typedef struct roof_phase
+{
+    char* name;
+    double flops;
+    double bytes;
+    double sec;
+} roof_phase_t;
+
+void roofline_init(fixedgrid_t* G)
+{
+    G->roof.sweep[X_AXIS] = 0;
+    G->roof.sweep[Y_AXIS] = 0;
+    G->roof.sweep[Z_AXIS] = 0;
+    G->roof.plane = 0;
+    G->roof.stream = 0.0;
+}
+
+/**
+ * Adds the cell updates of one thread's share of a sweep.
+ * Called once per thread per sweep.
+ */
+void roofline_sweep(fixedgrid_t* G, int axis, uint64_t updates)
+{
+    #pragma omp atomic
+    G->roof.sweep[axis] += updates;
+}
+
+/**
+ * Adds the cell updates of one thread's planes
+ */
+void roofline_plane(fixedgrid_t* G, uint64_t updates)
+{
+    #pragma omp atomic
+    G->roof.plane += updates;
+}
+
+/**
+ * Returns the bandwidth (GB/s) of a triad on nthreads threads
+ */
+double stream_triad(int nthreads)
+{
+    double *a, *b, *c;
+    double start, t, best = 0.0;
+    const double s = 3.0;
+    long i;
+    int r;
+
+    a = (double*)malloc(sizeof(double)*STREAM_N);
+    b = (double*)malloc(sizeof(double)*STREAM_N);
+    c = (double*)malloc(sizeof(double)*STREAM_N);
+    if(!a || !b || !c)
+    {
+        fprintf(stderr, "Couldn't allocate the bandwidth probe.\n");
+        free(a); free(b); free(c);
+        return 0.0;
+    }
+
+    /* First touch by the threads that use each page */
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for(i=0; i<STREAM_N; i++)
+    {
+        a[i] = 0.0;
+        b[i] = 1.0;
+        c[i] = 2.0;
+    }
+
+    for(r=0; r<STREAM_REPS; r++)
+    {
+        start = omp_get_wtime();
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for(i=0; i<STREAM_N; i++)
+            a[i] = b[i] + s*c[i];
+        t = omp_get_wtime() - start;
+        if(r == 0 || t < best)
+            best = t;
+    }
+
+    /* Keep the result live */
+    if(a[STREAM_N/2] != 7.0)
+        fprintf(stderr, "Bandwidth probe failed.\n");
+
+    free(a);
+    free(b);
+    free(c);
+
+    return best > 0.0 ? 3.0*sizeof(double)*STREAM_N / best * 1.0e-9 : 0.0;
+}
+
+#if DO_CHEMISTRY == 1
+/**
+ * Returns the operations of one KppDecomp
+ */
+static double decomp_flops()
+{
+    int k, kk, j;
+    double n = 0.0;
+
+    for(k=0; k<NVAR; k++)
+    {
+        for(kk=LU_CROW[k]; kk<LU_DIAG[k]; kk++)
+        {
+            j = LU_ICOL[kk];
+            /* One division, then a multiply-add per entry right of the pivot */
+            n += 1.0 + 2.0*(LU_CROW[j+1] - LU_DIAG[j] - 1);
+        }
+    }
+
+    return n;
+}
+#endif
+
+/**
+ * Fills in the work and time of each phase.  Returns the number of phases.
+ */
+static int roofline_phases(fixedgrid_t* G, roof_phase_t* p)
+{
+    const double cells = (double)NX*NY*NZ;
+    const double values = SWEEP_VALUES*sizeof(real_t);
+    double chem_flops = 0.0, chem_bytes = 0.0;
+    int n = 0;
+
+#if DO_CHEMISTRY == 1
+    /* Night-time calls run the dark kernels */
+    chem_flops = (G->chem_stats[0] - G->chem_stats[8])*(double)FUN_FLOPS
+               + G->chem_stats[8]*(double)FUN_DARK_FLOPS
+               + (G->chem_stats[1] - G->chem_stats[9])*(double)JAC_SP_FLOPS
+               + G->chem_stats[9]*(double)JAC_SP_DARK_FLOPS
+               + G->chem_stats[10]*(double)FUN_PHOTO_FLOPS
+               + G->chem_stats[5]*decomp_flops()
+               + G->chem_stats[6]*(double)KPPSOLVE_FLOPS;
+#if CHEM_MIXED_LU == 1
+    /* Each refined solve is two substitutions and one Jac_SP_Vec */
+    chem_flops += G->chem_stats[6]/2 * (double)JAC_SP_VEC_FLOPS;
+#endif
+
+    /* Concentrations in and out, temperature, start step and cost */
+    chem_bytes = G->chem_rate.calls * cells
+               * (2.0*NSPEC*sizeof(real_t) + sizeof(real_t) + 2.0*sizeof(float) + sizeof(uint16_t));
+#endif
+
+    p[n].name = "X discret";
+    p[n].flops = G->roof.sweep[X_AXIS] * (double)SWEEP_FLOPS;
+    p[n].bytes = G->roof.sweep[X_AXIS] * values;
+    p[n++].sec = timer_total(&G->metrics, "X discret");
+
+    p[n].name = "Y discret";
+    p[n].flops = G->roof.sweep[Y_AXIS] * (double)SWEEP_FLOPS;
+    p[n].bytes = G->roof.sweep[Y_AXIS] * values;
+    p[n++].sec = timer_total(&G->metrics, "Y discret");
+
+    p[n].name = "Z discret";
+    p[n].flops = G->roof.sweep[Z_AXIS] * (double)SWEEP_FLOPS;
+    p[n].bytes = G->roof.sweep[Z_AXIS] * values;
+    p[n++].sec = timer_total(&G->metrics, "Z discret");
+
+    p[n].name = "Unsplit";
+    p[n].flops = G->unsplit.passes * cells * NLOOKAT * (double)UNSPLIT_FLOPS;
+    p[n].bytes = G->unsplit.passes * cells * NLOOKAT * UNSPLIT_VALUES*sizeof(real_t);
+    p[n++].sec = timer_total(&G->metrics, "Unsplit");
+
+    /* The pipeline times its z sweeps inside its own timer,
+     * and runs the chemistry without a timer of its own */
+    p[n].name = "Planes";
+    p[n].flops = G->roof.plane * (double)SWEEP_FLOPS;
+    p[n].bytes = G->roof.plane * values;
+    p[n].sec = timer_total(&G->metrics, "Planes");
+    if(p[n].sec > 0.0)
+    {
+        p[n].sec -= timer_total(&G->metrics, "Z discret");
+        p[n].flops += chem_flops;
+        p[n].bytes += chem_bytes;
+        chem_flops = chem_bytes = 0.0;
+    }
+    ++n;
+
+    p[n].name = "Chemistry";
+    p[n].flops = chem_flops;
+    p[n].bytes = chem_bytes;
+    p[n++].sec = timer_total(&G->metrics, "Chemistry");
+
+    return n;
+}
+
+/**
+ * Displays the operations, traffic and rates of each phase
+ */
+void print_roofline(fixedgrid_t* G)
+{
+    roof_phase_t p[ROOF_PHASES];
+    double ai;
+    int i, n;
+
+    if(!G->roof.enabled)
+        return;
+
+    G->roof.stream = stream_triad(G->nprocs);
+    n = roofline_phases(G, p);
+
+    printf("\n===== Roofline =====\n");
+    printf("Memory bandwidth (triad, %d threads, %d MB): %.2f GB/s\n",
+           G->nprocs, (int)(3*sizeof(double)*STREAM_N >> 20), G->roof.stream);
+    printf("%-12s %10s %10s %10s %8s %10s %10s %8s %12s\n", "Phase", "Sec", "GFLOP", "GB",
+           "Flop/B", "GFLOP/s", "GB/s", "%Triad", "Roof GFLOP/s");
+    for(i=0; i<n; i++)
+    {
+        if(p[i].sec <= 0.0 || p[i].flops <= 0.0)
+            continue;
+        ai = p[i].bytes > 0.0 ? p[i].flops / p[i].bytes : 0.0;
+        printf("%-12s %10.4f %10.4f %10.4f %8.2f %10.4f %10.4f %7.1f%% %12.2f\n", p[i].name, p[i].sec,
+               p[i].flops*1.0e-9, p[i].bytes*1.0e-9, ai,
+               p[i].flops / p[i].sec * 1.0e-9, p[i].bytes / p[i].sec * 1.0e-9,
+               G->roof.stream > 0.0 ? 100.0 * p[i].bytes / p[i].sec * 1.0e-9 / G->roof.stream : 0.0,
+               ai * G->roof.stream);
+    }
+}
+
+/**
+ * Writes the operations, traffic and rates of each phase to a CSV file
+ */
+void write_roofline_to_csv_file(fixedgrid_t* G, FILE* fptr)
+{
+    roof_phase_t p[ROOF_PHASES];
+    int i, n;
+
+    if(!G->roof.enabled)
+        return;
+
+    n = roofline_phases(G, p);
+
+    fprintf(fptr, "Roofline,Triad GB/s,%f,\n", G->roof.stream);
+    fprintf(fptr, "Phase,Sec,Flops,Bytes,GFLOP/s,GB/s,\n");
+    for(i=0; i<n; i++)
+    {
+        if(p[i].sec <= 0.0 || p[i].flops <= 0.0)
+            continue;
+        fprintf(fptr, "%s,%f,%e,%e,%f,%f,\n", p[i].name, p[i].sec, p[i].flops, p[i].bytes,
+                p[i].flops / p[i].sec * 1.0e-9, p[i].bytes / p[i].sec * 1.0e-9);
+    }
+    fprintf(fptr, ",\n,\n");
+}
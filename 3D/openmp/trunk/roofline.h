@@ -0,0 +1,71 @@
+/*
+ *  roofline.h
+ *
+ *  Floating point operations and memory traffic of each phase,
+ *  counted analytically, with the rates they imply and the memory
+ *  bandwidth of the machine measured by a STREAM-style triad.
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#ifndef __ROOFLINE_H__
+#define __ROOFLINE_H__
+
+/**************************************************
+ * Includes                                       *
+ **************************************************/
+
+#include <stdio.h>
+
+#include "fixedgrid.h"
+#include "params.h"
+
+/**************************************************
+ * Macros                                         *
+ **************************************************/
+
+/* Operations of one cell update of one species by discretize:
+ * two evaluations of advec_diff (30 each), two Euler updates
+ * and the average of the stages */
+#define SWEEP_FLOPS 66
+
+/* Values moved per cell update: the concentration in and out,
+ * and the wind and diffusion, which all species share */
+#define SWEEP_VALUES (2.0 + 2.0/NLOOKAT)
+
+/* Operations of one cell update of one species by an unsplit
+ * pass: three evaluations of advec_diff, their sum and the
+ * stage update (95 for the first stage, 97 for the second) */
+#define UNSPLIT_FLOPS 96
+
+/* Values moved per cell update by an unsplit pass: the first
+ * stage reads the concentration and writes the stage, the second
+ * reads both and writes the concentration, and each pass reads
+ * three winds and two diffusions shared by the species */
+#define UNSPLIT_VALUES (2.5 + 5.0/NLOOKAT)
+
+/* Doubles in each array of the bandwidth probe */
+#define STREAM_N    (1 << 22)
+
+/* Times the probe is repeated; the fastest counts */
+#define STREAM_REPS 5
+
+/**************************************************
+ * Function prototypes                            *
+ **************************************************/
+
+void roofline_init(fixedgrid_t* G);
+
+void roofline_sweep(fixedgrid_t* G, int axis, uint64_t updates);
+
+void roofline_plane(fixedgrid_t* G, uint64_t updates);
+
+double stream_triad(int nthreads);
+
+void print_roofline(fixedgrid_t* G);
+
+void write_roofline_to_csv_file(fixedgrid_t* G, FILE* fptr);
+
+#endif
@@ -0,0 +1,268 @@
+#!/bin/bash
+#
+# Strong and weak scaling of fixedgrid.  Builds fixedgrid in a scratch
+# copy of the sources and runs it over a set of thread counts:
+#
+#   strong - the same grid (STRONG, or the one in PARAMS) on every
+#            thread count
+#   weak   - a grid of WEAK cells per thread: the y dimension grows
+#            with the thread count, so each thread keeps the same number
+#            of rows of every x sweep and chemistry plane
+#
+# and writes, in OUT,
+#
+#   scaling.csv  - one row per run: grid, steps, wallclock and phase
+#                  times, speedup and parallel efficiency
+#   scaling.json - the same, with the build and host
+#   summary.txt  - a table of the above, also printed
+#
+# Speedup and efficiency are relative to the smallest thread count.
+# Strong: speedup = T(n0)/T(n), efficiency = speedup*n0/n.  Weak:
+# efficiency = T(n0)/T(n), scaled speedup = efficiency*n/n0.  Phase
+# speedups (x, y, z, chem, io) are computed the same way from the
+# metrics timers.
+#
+# usage: ./scale.sh [threads] [fixedgrid options] [-- make options]
+#   e.g. ./scale.sh "1 2 4 8" -unsplit -- CC=gcc LD=gcc CFLAGS="-O3 -fopenmp" LDFLAGS="-fopenmp -lm"
+#
+# Environment:
+#   PARAMS     params file of the runs (default config/params.h),
+#              e.g. config/params_200x200x24.h
+#   STRONG     strong scaling grid, NXxNYxNZ (default: the grid in PARAMS,
+#              "none" to skip)
+#   WEAK       weak scaling grid per thread, NXxNYxNZ (default 64x32x12,
+#              "none" to skip)
+#   START_HOUR hour the runs start (default 12)
+#   MINUTES    simulated minutes per run (default 10)
+#   REPEATS    runs per configuration, the fastest is kept (default 1)
+#   DEFS       extra -D options, e.g. DEFS=-DCHEM_STRIDE=4
+#   OUT        results directory (default Output/scaling)
+#
+
+THREADS=${1:-"1 2 4 8"}
+shift
+
+ARGS=""
+while [ $# -gt 0 ] && [ "$1" != "--" ] ; do
+	ARGS="$ARGS $1"
+	shift
+done
+[ "$1" == "--" ] && shift
+
+PARAMS=${PARAMS:-config/params.h}
+WEAK=${WEAK:-64x32x12}
+START_HOUR=${START_HOUR:-12}
+MINUTES=${MINUTES:-10}
+REPEATS=${REPEATS:-1}
+OUT=${OUT:-Output/scaling}
+
+if [ -z "$STRONG" ] ; then
+	STRONG=`awk '$1 == "#define" && ($2 == "NX" || $2 == "NY" || $2 == "NZ") { d[$2] = $3 }
+		END { print d["NX"] "x" d["NY"] "x" d["NZ"] }' $PARAMS`
+fi
+
+END=$(( START_HOUR*60 + MINUTES ))
+if [ $END -ge 1440 ] ; then
+	echo "Runs must end on the day they start (START_HOUR $START_HOUR, MINUTES $MINUTES)" >&2
+	exit 1
+fi
+TIMEDEFS="-DSTART_HOUR=$START_HOUR -DSTART_MIN=0 -DEND_HOUR=$(( END/60 )) -DEND_MIN=$(( END%60 ))"
+
+# Scratch copy of the sources with PARAMS as config/params.h.
+# OUT may hold other files, so only what this script writes is removed.
+BUILD=$OUT/build
+rm -rf $BUILD
+rm -f $OUT/fixedgrid_* $OUT/build_*.out $OUT/runs.txt $OUT/scaling.csv $OUT/scaling.json $OUT/summary.txt
+mkdir -p $BUILD/Output
+cp -r Makefile *.c *.h chem util config $BUILD/ || exit 1
+cp $PARAMS $BUILD/config/params.h || exit 1
+
+#
+# build <NXxNYxNZ>
+#   Builds fixedgrid for a grid, with the source in the middle,
+#   as $OUT/fixedgrid_<grid>
+#
+build()
+{
+	local g=$1 nx ny nz
+	shift
+	[ -x $OUT/fixedgrid_$g ] && return 0
+	IFS=x read nx ny nz <<< "$g"
+	echo -n "Building $g..."
+	( cd $BUILD && make clean > /dev/null && \
+	  make DEFS="-DNX=$nx -DNY=$ny -DNZ=$nz -DSOURCE_X=$(( nx/2 )) -DSOURCE_Y=$(( ny/2 )) -DSOURCE_Z=$(( nz/2 )) $TIMEDEFS $DEFS" "$@" ) \
+		> $OUT/build_$g.out 2>&1 || { echo " failed!  See $OUT/build_$g.out" ; exit 1 ; }
+	cp $BUILD/fixedgrid $OUT/fixedgrid_$g
+	echo " done!"
+}
+
+#
+# run <mode> <threads> <grid>
+#   Runs fixedgrid REPEATS times and appends the fastest
+#   run to $OUT/runs.txt
+#
+run()
+{
+	local r log best=""
+	for r in `seq 1 $REPEATS` ; do
+		log=$OUT/fixedgrid_$1_$2_$r.out
+		echo -n "Running $1 scaling on $2 threads, $3 grid ($r of $REPEATS)..."
+		( cd $BUILD && OMP_NUM_THREADS=$2 ../fixedgrid_$3 $2 $ARGS ) > $log 2>&1 || { echo " failed!  See $log" ; exit 1 ; }
+		echo " done!"
+		rm -f $BUILD/Output/OUT_*
+		if [ -z "$best" ] || awk -v a=$log -v b=$best 'BEGIN {
+				while((getline l < a) > 0) if(l ~ /^Wallclock/) { split(l, f, ":") ; ta = f[2] + 0 }
+				while((getline l < b) > 0) if(l ~ /^Wallclock/) { split(l, f, ":") ; tb = f[2] + 0 }
+				exit !(ta < tb) }' ; then
+			best=$log
+		fi
+	done
+	echo "$1 $2 $3 $best" >> $OUT/runs.txt
+}
+
+for n in $THREADS ; do
+	[ "$STRONG" != "none" ] && build $STRONG "$@"
+	if [ "$WEAK" != "none" ] ; then
+		IFS=x read nx ny nz <<< "$WEAK"
+		build ${nx}x$(( ny*n ))x$nz "$@"
+	fi
+done
+( cd $BUILD && make clean > /dev/null )
+
+rm -f $OUT/runs.txt
+for n in $THREADS ; do
+	[ "$STRONG" != "none" ] && run strong $n $STRONG
+	if [ "$WEAK" != "none" ] ; then
+		IFS=x read nx ny nz <<< "$WEAK"
+		run weak $n ${nx}x$(( ny*n ))x$nz
+	fi
+done
+
+# Collect the timers of each run and compute speedup and efficiency
+awk -v csv=$OUT/scaling.csv -v json=$OUT/scaling.json \
+    -v host="`uname -n`" -v date="`date '+%Y-%m-%d %H:%M:%S'`" \
+    -v make="$*" -v args="$ARGS" -v params="$PARAMS" -v minutes=$MINUTES '
+
+function trim(s) { sub(/^ */, "", s) ; sub(/ *$/, "", s) ; return s }
+
+# Reads one fixedgrid log
+function load(i, file,    l, f, t, timers) {
+	threads[i] = 0 ; steps[i] = 0 ; timers = 0
+	while((getline l < file) > 0) {
+		if(l ~ /^Running on [0-9]+ threads/) { split(l, f, " ") ; threads[i] = f[3] }
+		else if(l ~ /^Timesteps:/) { split(l, f, " ") ; steps[i] = f[2] }
+		else if(l ~ /^===== /) timers = 1
+		else if(timers && split(l, f, ":") == 2 && f[2] ~ /^ *[0-9.]+ +[0-9]+ /) {
+			# Timer tree: a phase nested in several timers is summed
+			t = trim(f[1])
+			time[i, t] += f[2] + 0
+		}
+	}
+	close(file)
+}
+
+function ratio(a, b) { return b > 0 ? a / b : 0 }
+
+BEGIN {
+	nphase = split("X discret,Y discret,Z discret,Unsplit,Planes,Chemistry,File I/O,Array Copy,Array Init", phase, ",")
+	split("x,y,z,unsplit,planes,chem,io,copy,init", key, ",")
+}
+
+{
+	++nrun
+	mode[nrun] = $1 ; grid[nrun] = $3
+	split($3, d, "x") ; nx[nrun] = d[1] ; ny[nrun] = d[2] ; nz[nrun] = d[3]
+	load(nrun, $4)
+	if(threads[nrun] != $2)
+		printf("Warning: asked for %d threads but ran on %d (%s)\n", $2, threads[nrun], $4) > "/dev/stderr"
+	if(!(mode[nrun] in base) || threads[nrun] < threads[base[mode[nrun]]])
+		base[mode[nrun]] = nrun
+}
+
+END {
+	# Speedup and efficiency against the smallest thread count
+	for(i=1; i<=nrun; i++) {
+		b = base[mode[i]]
+		wall[i] = time[i, "Wallclock"]
+		cells[i] = nx[i]*ny[i]*nz[i]
+		rate[i] = ratio(cells[i]*steps[i], wall[i])
+		if(mode[i] == "strong") {
+			speedup[i] = ratio(wall[b], wall[i])
+			eff[i] = ratio(speedup[i]*threads[b], threads[i])
+		} else {
+			eff[i] = ratio(wall[b], wall[i])
+			speedup[i] = ratio(eff[i]*threads[i], threads[b])
+		}
+		# Phases that did not run have no speedup
+		for(p=1; p<=nphase; p++) {
+			t = time[i, phase[p]]
+			if(time[b, phase[p]] <= 0 || t <= 0)
+				psp[i, p] = ""
+			else if(mode[i] == "strong")
+				psp[i, p] = ratio(time[b, phase[p]], t)
+			else
+				psp[i, p] = ratio(time[b, phase[p]] * threads[i], t * threads[b])
+		}
+	}
+
+	# CSV
+	printf("mode,threads,nx,ny,nz,cells,steps,wallclock") > csv
+	for(p=1; p<=nphase; p++) printf(",%s", key[p]) > csv
+	printf(",cells_per_sec,speedup,efficiency") > csv
+	for(p=1; p<=nphase; p++) printf(",%s_speedup", key[p]) > csv
+	printf("\n") > csv
+	for(i=1; i<=nrun; i++) {
+		printf("%s,%d,%d,%d,%d,%d,%d,%f", mode[i], threads[i], nx[i], ny[i], nz[i], cells[i], steps[i], wall[i]) > csv
+		for(p=1; p<=nphase; p++) printf(",%f", time[i, phase[p]]) > csv
+		printf(",%e,%f,%f", rate[i], speedup[i], eff[i]) > csv
+		for(p=1; p<=nphase; p++) printf(psp[i, p] == "" ? ",%s" : ",%f", psp[i, p]) > csv
+		printf("\n") > csv
+	}
+
+	# JSON
+	gsub(/"/, "\\\"", make) ; gsub(/"/, "\\\"", args)
+	printf("{\n  \"host\": \"%s\",\n  \"date\": \"%s\",\n  \"params\": \"%s\",\n", host, date, params) > json
+	printf("  \"make\": \"%s\",\n  \"args\": \"%s\",\n  \"minutes\": %d,\n  \"runs\": [\n", make, trim(args), minutes) > json
+	for(i=1; i<=nrun; i++) {
+		printf("    {\"mode\": \"%s\", \"threads\": %d, \"nx\": %d, \"ny\": %d, \"nz\": %d, \"steps\": %d,\n", \
+			mode[i], threads[i], nx[i], ny[i], nz[i], steps[i]) > json
+		printf("     \"wallclock\": %f, \"cells_per_sec\": %e, \"speedup\": %f, \"efficiency\": %f,\n", \
+			wall[i], rate[i], speedup[i], eff[i]) > json
+		printf("     \"phases\": {") > json
+		for(p=1; p<=nphase; p++)
+			printf("%s\"%s\": {\"time\": %f, \"speedup\": %s}", p > 1 ? ", " : "", key[p], time[i, phase[p]], \
+				psp[i, p] == "" ? "null" : sprintf("%f", psp[i, p])) > json
+		printf("}}%s\n", i < nrun ? "," : "") > json
+	}
+	printf("  ]\n}\n") > json
+
+	# Summary
+	for(m=1; m<=2; m++) {
+		md = m == 1 ? "strong" : "weak"
+		if(!(md in base)) continue
+		printf("\n%s scaling (%s, %d minutes)\n\n", md == "strong" ? "Strong" : "Weak", params, minutes)
+		printf("%8s %14s %10s %10s %8s %6s %8s %8s %8s %8s %8s\n", "Threads", "Grid", "Wallclock", "Cells/s", \
+			md == "strong" ? "Speedup" : "Scaled", "Eff", "X", "Y", "Z", "Chem", "I/O")
+		for(i=1; i<=nrun; i++) {
+			if(mode[i] != md) continue
+			printf("%8d %14s %10.3f %10.3e %8.2f %5.0f%%", threads[i], grid[i], wall[i], rate[i], speedup[i], 100*eff[i])
+			for(p=1; p<=nphase; p++)
+				if(key[p] ~ /^(x|y|z|chem|io)$/)
+					printf(" %8.3f", time[i, phase[p]])
+			printf("\n")
+		}
+		printf("\n%8s %14s", "Threads", "Phase speedup")
+		printf(" %8s %8s %8s %8s %8s\n", "X", "Y", "Z", "Chem", "I/O")
+		for(i=1; i<=nrun; i++) {
+			if(mode[i] != md) continue
+			printf("%8d %14s", threads[i], "")
+			for(p=1; p<=nphase; p++)
+				if(key[p] ~ /^(x|y|z|chem|io)$/)
+					printf(psp[i, p] == "" ? " %8s" : " %8.2f", psp[i, p] == "" ? "-" : psp[i, p])
+			printf("\n")
+		}
+	}
+}' $OUT/runs.txt | tee $OUT/summary.txt
+
+echo
+echo "Results stored to $OUT/scaling.csv, $OUT/scaling.json and $OUT/summary.txt"
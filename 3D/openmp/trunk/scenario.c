@@ -0,0 +1,334 @@
+/*
+ *  scenario.c
+ *
+ *  Synthetic scenarios.
+ *
+ *  The uniform fields of init_model never change the sign of the
+ *  wind, so the transport kernels always take the same upwind branch,
+ *  and a single source leaves almost every cell in the same chemical
+ *  regime.  A synthetic scenario replaces them with analytic fields:
+ *    - rotating: one vortex filling the domain, so the wind points every
+ *      way, plus a background wind that turns once a day,
+ *    - shear: a jet whose direction alternates across y, over a
+ *      cross wind that reverses with height and turns once a day,
+ *  both scaled by a power-law profile with height (SCENARIO_WIND at
+ *  the top), with a weak vertical wind of random phase.  The
+ *  horizontal diffusivity is DIFF_H_INIT modulated by SCENARIO_MODES
+ *  sine modes of random phase (0.2 to 1.8 times), the vertical
+ *  diffusivity follows a boundary layer that mixes by day, and the
+ *  temperature has a diurnal cycle, a lapse with height and a random
+ *  horizontal pattern.  SCENARIO_SOURCES sources at random cells near
+ *  the ground emit NO, NO2, CO, VOCs (traffic profile, peaks at 08:00
+ *  and 17:30), isoprene (follows the sun) or SO2 (constant), at peak
+ *  rates spread log-uniformly over two decades around SCENARIO_RATE.
+ *  Sunlight follows the SUN of the photolysis rates (04:30 to 19:30).
+ *  Without chemistry every source emits O3.
+ *
+ *  All random choices come from the seed, so a scenario is the same
+ *  on every run and machine.  The fields are updated after every
+ *  timestep and G->met_update is set, so the stability rates are
+ *  remeasured and the operators synchronized each step as they would
+ *  be with met fields read from a driver model.
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#include <stdio.h>
+#include <math.h>
+
+#include "scenario.h"
+#include "timer.h"
+#include "saprc99_Monitor.h"
+
+/* State of the random number generator */
+static uint64_t rng_state;
+
+/**
+ * Returns the next 64 random bits (SplitMix64)
+ */
+static uint64_t rng_next()
+{
+    uint64_t z;
+
+    z = (rng_state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+
+    return z ^ (z >> 31);
+}
+
+/**
+ * Returns a random number in [0, 1)
+ */
+static double rng_uniform()
+{
+    return (rng_next() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/**
+ * Returns the hour of the day at time t (sec)
+ */
+static double hour_of_day(double t)
+{
+    return fmod(t, 86400.0) / 3600.0;
+}
+
+/* Daylight hours of the photolysis rates (Update_SUN in chem/saprc99_Rates.c) */
+#define SUN_RISE 4.5
+#define SUN_SET  19.5
+
+/**
+ * Returns the sunlight (0 to 1) at hour h, the same SUN
+ * the chemistry's photolysis rates follow
+ */
+static double sunlight(double h)
+{
+    double t;
+
+    if(h < SUN_RISE || h > SUN_SET)
+        return 0.0;
+
+    t = (2.0*h - SUN_RISE - SUN_SET) / (SUN_SET - SUN_RISE);
+    t = t > 0.0 ? t*t : -t*t;
+
+    return 0.5*(1.0 + cos(M_PI*t));
+}
+
+/**
+ * Returns the emission of a source with the given profile at hour h,
+ * as a fraction of its peak rate
+ */
+static double diurnal(int32_t profile, double h)
+{
+    switch(profile)
+    {
+    case SOURCE_TRAFFIC:
+        return 0.2 + 0.8*exp(-(h - 8.0)*(h - 8.0)/2.25) + 0.6*exp(-(h - 17.5)*(h - 17.5)/4.0);
+    case SOURCE_SOLAR:
+        return sunlight(h);
+    default:
+        return 1.0;
+    }
+}
+
+/**
+ * Places the emission sources
+ */
+static void place_sources(fixedgrid_t* G)
+{
+#if DO_CHEMISTRY == 1
+    /* Emitted species and their profiles */
+    static const int32_t species[][2] = {
+        { ind_NO,       SOURCE_TRAFFIC },
+        { ind_NO2,      SOURCE_TRAFFIC },
+        { ind_CO,       SOURCE_TRAFFIC },
+        { ind_HCHO,     SOURCE_TRAFFIC },
+        { ind_ALK4,     SOURCE_TRAFFIC },
+        { ind_ETHENE,   SOURCE_TRAFFIC },
+        { ind_ARO1,     SOURCE_TRAFFIC },
+        { ind_ISOPRENE, SOURCE_SOLAR },
+        { ind_SO2,      SOURCE_CONSTANT }
+    };
+    const int32_t nspecies = sizeof(species) / sizeof(species[0]);
+#endif
+
+    scenario_source_t* src;
+    int32_t i, k;
+
+    for(i=0; i<SCENARIO_SOURCES; i++)
+    {
+        src = &G->scen.src[i];
+
+        src->x = rng_next() % NX;
+        src->y = rng_next() % NY;
+        src->z = rng_next() % (NZ > 4 ? NZ/4 : 1);
+
+#if DO_CHEMISTRY == 1
+        k = rng_next() % nspecies;
+        src->s = species[k][0];
+        src->profile = species[k][1];
+#else
+        k = rng_next() % 3;
+        src->s = ind_O3;
+        src->profile = k;
+#endif
+
+        src->rate = SCENARIO_RATE * pow(10.0, 2.0*rng_uniform() - 1.0);
+    }
+}
+
+/**
+ * Sets the wind, diffusion and temperature fields at time t
+ */
+static void scenario_met(fixedgrid_t* G, double t)
+{
+    scenario_t* S = &G->scen;
+    int32_t i, k, x, y, z;
+    double h, sun, theta, zc, m, w, u0, ub;
+
+    timer_start(&G->metrics, "Met Update");
+
+    h = hour_of_day(t);
+    sun = sunlight(h);
+    theta = 2.0*M_PI*h/24.0;
+    u0 = SCENARIO_WIND;
+    ub = 0.3*SCENARIO_WIND;
+
+    #pragma omp parallel for private(i, k, x, y, z, zc, m, w) schedule(static)
+    for(i=0; i<NZ*NY; i++)
+    {
+        z = i / NY;
+        y = i % NY;
+        zc = (z + 0.5) / NZ;
+
+        for(x=0; x<NX; x++)
+        {
+            if(S->kind == SCENARIO_ROTATING)
+            {
+                G->wind_u(x, y, z) = S->pz[z] * (u0*S->ax[x]*S->by[y] + ub*cos(theta));
+                G->wind_v(x, y, z) = S->pz[z] * (-u0*S->bx[x]*S->ay[y] + ub*sin(theta));
+            }
+            else
+            {
+                G->wind_u(x, y, z) = S->pz[z] * (u0*S->by[y] + ub*cos(theta));
+                G->wind_v(x, y, z) = S->pz[z] * (0.5*u0*(2.0*zc - 1.0)*sin(theta) + 0.2*u0*S->ax[x]);
+            }
+
+            w = S->mx[0][x] * S->my[0][y];
+            G->wind_w(x, y, z) = 0.02*u0 * w * sin(M_PI*zc);
+
+            m = 0.0;
+            for(k=0; k<SCENARIO_MODES; k++)
+                m += S->mx[k][x] * S->my[k][y];
+            G->diff_h(x, y, z) = DIFF_H_INIT * (1.0 + 0.8*m/SCENARIO_MODES);
+            G->diff_v(x, y, z) = DIFF_V_INIT * (0.05 + S->kz[z]*(0.1 + 0.9*sun));
+
+            G->temp(x, y, z) = TEMP_INIT + 5.0*sun - 10.0*zc + 2.0*w;
+        }
+    }
+
+    timer_stop(&G->metrics, "Met Update");
+}
+
+/**
+ * Builds the scenario from its seed and sets the fields at G->time.
+ * Does nothing for the uniform fields.
+ */
+void scenario_init(fixedgrid_t* G)
+{
+    scenario_t* S = &G->scen;
+    int32_t x, y, z, k;
+    double xc, yc, zc, px, py;
+
+    if(S->kind == SCENARIO_UNIFORM)
+        return;
+
+    printf("Building %s scenario (seed %u)...", scenario_name(S->kind), S->seed);
+
+    rng_state = S->seed;
+
+    /* Random phases of the diffusivity modes and the vertical wind */
+    for(k=0; k<SCENARIO_MODES; k++)
+    {
+        px = 2.0*M_PI*rng_uniform();
+        py = 2.0*M_PI*rng_uniform();
+        for(x=0; x<NX; x++)
+            S->mx[k][x] = sin(2.0*M_PI*(k + 1)*(x + 0.5)/NX + px);
+        for(y=0; y<NY; y++)
+            S->my[k][y] = sin(2.0*M_PI*(k + 1)*(y + 0.5)/NY + py);
+    }
+
+    /* One vortex over the domain, or one period of shear */
+    for(x=0; x<NX; x++)
+    {
+        xc = (x + 0.5) / NX;
+        S->ax[x] = sin((S->kind == SCENARIO_ROTATING ? 1.0 : 2.0)*M_PI*xc);
+        S->bx[x] = cos((S->kind == SCENARIO_ROTATING ? 1.0 : 2.0)*M_PI*xc);
+    }
+    for(y=0; y<NY; y++)
+    {
+        yc = (y + 0.5) / NY;
+        S->ay[y] = sin((S->kind == SCENARIO_ROTATING ? 1.0 : 2.0)*M_PI*yc);
+        S->by[y] = cos((S->kind == SCENARIO_ROTATING ? 1.0 : 2.0)*M_PI*yc);
+    }
+
+    /* Wind speed grows with height; mixing is strongest near the ground */
+    for(z=0; z<NZ; z++)
+    {
+        zc = (z + 0.5) / NZ;
+        S->pz[z] = pow(zc, 1.0/7.0);
+        S->kz[z] = exp(-zc/0.3);
+    }
+
+    place_sources(G);
+
+    scenario_met(G, G->time);
+
+    /* Met fields change every timestep */
+    G->met_update = TRUE;
+
+    printf(" done.\n");
+}
+
+/**
+ * Adds the emissions of the timestep just taken
+ * and sets the fields for the next one
+ */
+void scenario_update(fixedgrid_t* G)
+{
+    scenario_source_t* src;
+    double h;
+    int32_t i;
+
+    if(G->scen.kind == SCENARIO_UNIFORM)
+        return;
+
+    /* Emission over the step at its midpoint rate */
+    h = hour_of_day(G->time + 0.5*G->dt);
+    for(i=0; i<SCENARIO_SOURCES; i++)
+    {
+        src = &G->scen.src[i];
+        G->conc(src->x, src->y, src->z, src->s) += src->rate * diurnal(src->profile, h) * G->dt;
+    }
+
+    scenario_met(G, G->time + G->dt);
+}
+
+/**
+ * Returns the name of a scenario
+ */
+char* scenario_name(int32_t kind)
+{
+    switch(kind)
+    {
+    case SCENARIO_UNIFORM:
+        return "UNIFORM";
+    case SCENARIO_ROTATING:
+        return "ROTATING";
+    case SCENARIO_SHEAR:
+        return "SHEAR";
+    default:
+        return "UNKNOWN";
+    }
+}
+
+/**
+ * Displays the emission sources of the scenario
+ */
+void print_scenario_sources(fixedgrid_t* G)
+{
+    static char* profiles[] = { "CONSTANT", "TRAFFIC", "SOLAR" };
+    scenario_source_t* src;
+    int32_t i;
+
+    printf("Emission sources (SPEC, X, Y, Z, PEAK RATE, PROFILE):\n");
+    for(i=0; i<SCENARIO_SOURCES; i++)
+    {
+        src = &G->scen.src[i];
+        printf("    (%s, %f, %f, %f, %E, %s)\n", SPC_NAMES[src->s],
+               (DX*src->x + DX*0.5), (DY*src->y + DY*0.5), (DZ*src->z + DZ*0.5),
+               src->rate, profiles[src->profile]);
+    }
+}
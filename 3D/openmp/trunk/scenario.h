@@ -0,0 +1,49 @@
+/*
+ *  scenario.h
+ *
+ *  Synthetic scenarios: analytic, time-dependent wind, diffusion
+ *  and temperature fields and many diurnal emission sources,
+ *  reproducible from a seed.
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#ifndef __SCENARIO_H__
+#define __SCENARIO_H__
+
+/**************************************************
+ * Includes                                       *
+ **************************************************/
+
+#include "fixedgrid.h"
+#include "params.h"
+
+/**************************************************
+ * Macros                                         *
+ **************************************************/
+
+/* Scenarios (SCENARIO in params.h) */
+#define SCENARIO_UNIFORM  0
+#define SCENARIO_ROTATING 1
+#define SCENARIO_SHEAR    2
+
+/* Diurnal profiles of the emission sources */
+#define SOURCE_CONSTANT 0
+#define SOURCE_TRAFFIC  1
+#define SOURCE_SOLAR    2
+
+/**************************************************
+ * Function prototypes                            *
+ **************************************************/
+
+void scenario_init(fixedgrid_t* G);
+
+void scenario_update(fixedgrid_t* G);
+
+char* scenario_name(int32_t kind);
+
+void print_scenario_sources(fixedgrid_t* G);
+
+#endif
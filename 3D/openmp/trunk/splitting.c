@@ -0,0 +1,114 @@
+/*
+ *  splitting.c
+ *
+ *  Operator splitting scheduler.
+ *
+ *  Each timestep is Strang split as x(dt/2), y(dt/2), z(dt), y(dt/2), x(dt/2).
+ *  The trailing x(dt/2) of step n is immediately followed by the leading
+ *  x(dt/2) of step n+1, so when no output, chemistry or met update needs
+ *  the state in between the two are issued as a single x sweep.
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#include "splitting.h"
+#include "transport.h"
+#include "multirate.h"
+
+/**
+ * Resets the scheduler
+ */
+void split_init(fixedgrid_t* G)
+{
+    G->split.x_pending = 0.0;
+    G->split.sweeps = 0;
+    G->split.fused = 0;
+}
+
+/**
+ * Returns TRUE if the state at the end of the current timestep
+ * is needed by something other than the next transport step.
+ */
+bool split_need_sync(fixedgrid_t* G)
+{
+#if MERGE_HALF_STEPS == 1 && WRITE_EACH_ITER != 1
+    /* Chemistry runs before the next step's leading sweep */
+#if DO_CHEMISTRY == 1
+    if(chem_rate_due(G)) return TRUE;
+#endif
+
+    /* Wind, diffusion or temperature fields change between steps.
+     * (TRUE with a synthetic scenario, see scenario.c.) */
+    if(G->met_update) return TRUE;
+
+    return FALSE;
+#else
+    /* Half-steps are not merged, or the concentration
+     * is written after every step */
+    return TRUE;
+#endif
+}
+
+/**
+ * Advances transport by one timestep.
+ * If sync is FALSE the trailing x half-step is deferred
+ * and merged into the leading x sweep of the next step.
+ */
+void split_step(fixedgrid_t* G, bool sync)
+{
+    real_t lead_dt;
+
+    /* Leading x sweep absorbs any deferred half-step */
+    lead_dt = G->dt*0.5 + G->split.x_pending;
+    if(G->split.x_pending > 0.0)
+        ++G->split.fused;
+
+    #pragma omp parallel shared(G, lead_dt, sync)
+    {
+        discretize_all_x(G, lead_dt);
+
+        discretize_all_y(G, G->dt*0.5);
+
+        discretize_all_z(G, G->dt);
+
+        discretize_all_y(G, G->dt*0.5);
+
+        if(sync)
+            discretize_all_x(G, G->dt*0.5);
+    }
+
+    if(sync)
+    {
+        G->split.x_pending = 0.0;
+        G->split.sweeps += 5;
+    }
+    else
+    {
+        G->split.x_pending = G->dt*0.5;
+        G->split.sweeps += 4;
+    }
+}
+
+/**
+ * Issues any deferred x half-step so the
+ * concentration field is consistent with G->time.
+ */
+void split_flush(fixedgrid_t* G)
+{
+    real_t dt;
+
+    if(G->split.x_pending > 0.0)
+    {
+        dt = G->split.x_pending;
+
+        #pragma omp parallel shared(G, dt)
+        {
+            discretize_all_x(G, dt);
+        }
+
+        G->split.x_pending = 0.0;
+        ++G->split.sweeps;
+    }
+}
@@ -0,0 +1,36 @@
+/*
+ *  splitting.h
+ *
+ *  Operator splitting scheduler.
+ *  Issues the Strang-split transport sweeps for each timestep and
+ *  fuses the trailing x half-step of one timestep with the leading
+ *  x half-step of the next whenever nothing needs the state between them.
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#ifndef __SPLITTING_H__
+#define __SPLITTING_H__
+
+/**************************************************
+ * Includes                                       *
+ **************************************************/
+
+#include "fixedgrid.h"
+#include "params.h"
+
+/**************************************************
+ * Function prototypes                            *
+ **************************************************/
+
+void split_init(fixedgrid_t* G);
+
+bool split_need_sync(fixedgrid_t* G);
+
+void split_step(fixedgrid_t* G, bool sync);
+
+void split_flush(fixedgrid_t* G);
+
+#endif
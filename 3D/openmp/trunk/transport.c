@@ -9,73 +9,129 @@
 
 #include "transport.h"
 #include "discretize.h"
+#include "cfl.h"
+#include "trace.h"
+#include "roofline.h"
 
 /**
- * Discretize rows
+ * Discretize one row of every species.
+ * Returns the cell updates made.
  */
-void discretize_all_x(fixedgrid_t* G, real_t dt)
+uint32_t discretize_row_x(fixedgrid_t* G, int32_t y, int32_t z, real_t dt)
 {
 #if DO_X_DISCRET == 1
     
-    int32_t x, y, z, s;
+    int32_t x, s;
+    uint32_t k, nsub;
     
     real_t buff[NX];
+    real_t *crow;
+    
+#if CONC_LAYOUT != LAYOUT_SPECIES_OUTER
+    /* Rows are not contiguous in this layout */
+    real_t row[NX];
+#endif
     
     /* Boundary values */
     real_t cbound[4];
     real_t wbound[4];
     real_t dbound[4];
     
-    timer_start(&G->metrics.x_discret);
+    /* Subcycle rows that would be unstable over dt */
+    nsub = cfl_substeps(NX, &G->wind_u(0, y, z), &G->diff_h(0, y, z), DX, dt);
+    
+    wbound[0] = G->wind_u(NX-2, y, z);
+    wbound[1] = G->wind_u(NX-1, y, z);
+    wbound[2] = G->wind_u(0, y, z);
+    wbound[3] = G->wind_u(1, y, z);
+    dbound[0] = G->diff_h(NX-2, y, z);
+    dbound[1] = G->diff_h(NX-1, y, z);
+    dbound[2] = G->diff_h(0, y, z);
+    dbound[3] = G->diff_h(1, y, z);
+    
+    for(s=0; s<NLOOKAT; s++)
+    {
+        for(k=0; k<nsub; k++)
+        {
+#if CONC_LAYOUT == LAYOUT_SPECIES_OUTER
+            crow = &G->conc(0, y, z, s);
+#else
+            timer_start(&G->metrics, "Array Copy");
+            for(x=0; x<NX; x++)
+                row[x] = G->conc(x, y, z, s);
+            timer_stop(&G->metrics, "Array Copy");
+            crow = row;
+#endif
+            
+            cbound[0] = crow[NX-2];
+            cbound[1] = crow[NX-1];
+            cbound[2] = crow[0];
+            cbound[3] = crow[1];
+            
+            discretize(NX, 
+                       crow, 
+                       &G->wind_u(0, y, z),
+                       &G->diff_h(0, y, z),
+                       cbound, wbound, dbound, 
+                       DX, dt/nsub, buff);
+            
+            timer_start(&G->metrics, "Array Copy");
+            for(x=0; x<NX; x++)
+                G->conc(x, y, z, s) = buff[x];
+            timer_stop(&G->metrics, "Array Copy");
+        }
+    }
+    
+    return NLOOKAT*nsub*NX;
+    
+#else
+    
+    return 0;
+    
+#endif
+}
+
+/**
+ * Discretize rows
+ */
+void discretize_all_x(fixedgrid_t* G, real_t dt)
+{
+#if DO_X_DISCRET == 1
+    
+    int32_t y, z;
+    uint64_t n = 0;
     
-    #pragma omp for private(z, y, x, s, buff, cbound, wbound, dbound)
+    timer_start(&G->metrics, "X discret");
+    
+    #pragma omp for private(z, y) nowait
     for(z=0; z<NZ; z++)
     {
         for(y=0; y<NY; y++)
         {
-            for(s=0; s<NLOOKAT; s++)
-            {
-                cbound[0] = G->conc(NX-2, y, z, s);
-                cbound[1] = G->conc(NX-1, y, z, s);
-                cbound[2] = G->conc(0, y, z, s);
-                cbound[3] = G->conc(1, y, z, s);
-                wbound[0] = G->wind_u(NX-2, y, z);
-                wbound[1] = G->wind_u(NX-1, y, z);
-                wbound[2] = G->wind_u(0, y, z);
-                wbound[3] = G->wind_u(1, y, z);
-                dbound[0] = G->diff_h(NX-2, y, z);
-                dbound[1] = G->diff_h(NX-1, y, z);
-                dbound[2] = G->diff_h(0, y, z);
-                dbound[3] = G->diff_h(1, y, z);
-                
-                discretize(NX, 
-                           &G->conc(0, y, z, s), 
-                           &G->wind_u(0, y, z),
-                           &G->diff_h(0, y, z),
-                           cbound, wbound, dbound, 
-                           DX, dt, buff);
-                
-                timer_start(&G->metrics.array_copy);
-                for(x=0; x<NX; x++)
-                    G->conc(x, y, z, s) = buff[x];
-                timer_stop(&G->metrics.array_copy);
-            }
+            n += discretize_row_x(G, y, z, dt);
         }
     }
     
-    timer_stop(&G->metrics.x_discret);
+    roofline_sweep(G, X_AXIS, n);
+    
+    trace_barrier();
+    
+    timer_stop(&G->metrics, "X discret");
     
 #endif
 }
 
 /**
- * Discretize y
+ * Discretize one y column of every species.
+ * Returns the cell updates made.
  */
-void discretize_all_y(fixedgrid_t* G, real_t dt)
+uint32_t discretize_col_y(fixedgrid_t* G, int32_t x, int32_t z, real_t dt)
 {
 #if DO_Y_DISCRET == 1
     
-    int32_t x, y, z, s;
+    int32_t y, s;
+    uint32_t k, nsub;
+    uint32_t n = 0;
     
     /* Buffers */
     real_t ccol1[NY];
@@ -88,51 +144,133 @@ void discretize_all_y(fixedgrid_t* G, real_t dt)
     real_t wbound[4];
     real_t dbound[4];
     
-    timer_start(&G->metrics.y_discret);
-    
-    #pragma omp for private(z, y, x, s, ccol1, ccol2, wcol, dcol, cbound, wbound, dbound)
-    for(z=0; z<NZ; z++)
+    for(s=0; s<NLOOKAT; s++)
     {
-        for(x=0; x<NX; x++)
+        timer_start(&G->metrics, "Array Copy");
+        for(y=0; y<NY; y++)
+        {
+            ccol1[y] = G->conc(x, y, z, s);
+            wcol[y]  = G->wind_v(x, y, z);
+            dcol[y]  = G->diff_h(x, y, z);
+        }
+        timer_stop(&G->metrics, "Array Copy");
+        
+        wbound[0] = wcol[NY-2];
+        wbound[1] = wcol[NY-1];
+        wbound[2] = wcol[0];
+        wbound[3] = wcol[1];
+        dbound[0] = dcol[NY-2];
+        dbound[1] = dcol[NY-1];
+        dbound[2] = dcol[0];
+        dbound[3] = dcol[1];
+        
+        /* Subcycle columns that would be unstable over dt */
+        nsub = cfl_substeps(NY, wcol, dcol, DY, dt);
+        n += nsub*NY;
+        
+        for(k=0; k<nsub; k++)
         {
-            for(s=0; s<NLOOKAT; s++)
+            if(k > 0)
             {
-                timer_start(&G->metrics.array_copy);
-                for(y=0; y<NY; y++)
-                {
-                    ccol1[y] = G->conc(x, y, z, s);
-                    wcol[y]  = G->wind_v(x, y, z);
-                    dcol[y]  = G->diff_h(x, y, z);
-                }
-                timer_stop(&G->metrics.array_copy);
-                
-                cbound[0] = ccol1[NY-2];
-                cbound[1] = ccol1[NY-1];
-                cbound[2] = ccol1[0];
-                cbound[3] = ccol1[1];
-                wbound[0] = wcol[NY-2];
-                wbound[1] = wcol[NY-1];
-                wbound[2] = wcol[0];
-                wbound[3] = wcol[1];
-                dbound[0] = dcol[NY-2];
-                dbound[1] = dcol[NY-1];
-                dbound[2] = dcol[0];
-                dbound[3] = dcol[1];
-                
-                discretize(NY, 
-                           ccol1, wcol, dcol, 
-                           cbound, wbound, dbound, 
-                           DY, dt, ccol2);
-                
-                timer_start(&G->metrics.array_copy);
                 for(y=0; y<NY; y++)
-                    G->conc(x, y, z, s) = ccol2[y];
-                timer_stop(&G->metrics.array_copy);
+                    ccol1[y] = ccol2[y];
             }
+            
+            cbound[0] = ccol1[NY-2];
+            cbound[1] = ccol1[NY-1];
+            cbound[2] = ccol1[0];
+            cbound[3] = ccol1[1];
+            
+            discretize(NY, 
+                       ccol1, wcol, dcol, 
+                       cbound, wbound, dbound, 
+                       DY, dt/nsub, ccol2);
+        }
+        
+        timer_start(&G->metrics, "Array Copy");
+        for(y=0; y<NY; y++)
+            G->conc(x, y, z, s) = ccol2[y];
+        timer_stop(&G->metrics, "Array Copy");
+    }
+    
+    return n;
+    
+#else
+    
+    return 0;
+    
+#endif
+}
+
+/**
+ * Discretize y
+ */
+void discretize_all_y(fixedgrid_t* G, real_t dt)
+{
+#if DO_Y_DISCRET == 1
+    
+    int32_t x, z;
+    uint64_t n = 0;
+    
+    timer_start(&G->metrics, "Y discret");
+    
+    #pragma omp for private(z, x) nowait
+    for(z=0; z<NZ; z++)
+    {
+        for(x=0; x<NX; x++)
+        {
+            n += discretize_col_y(G, x, z, dt);
         }
     }
     
-    timer_stop(&G->metrics.y_discret);
+    roofline_sweep(G, Y_AXIS, n);
+    
+    trace_barrier();
+    
+    timer_stop(&G->metrics, "Y discret");
+    
+#endif
+}
+
+/**
+ * Backward Euler vertical diffusion of every column
+ * in the xz-slice of species s at y
+ */
+void diffuse_slice_z(fixedgrid_t* G, int32_t y, int32_t s, real_t dt)
+{
+    /* Tridiagonal solver workspace */
+    real_t work[NZ*NX];
+    
+#if CONC_LAYOUT == LAYOUT_SPECIES_OUTER
+    
+    vdiff_implicit(NZ, NX,
+                   &G->conc(0, y, 0, s), NY*NX,
+                   &G->diff_v(0, y, 0), NY*NX,
+                   DZ, dt, work);
+    
+#else
+    
+    int32_t x, z;
+    
+    /* Slices are not contiguous in this layout */
+    real_t slice[NZ*NX];
+    
+    timer_start(&G->metrics, "Array Copy");
+    for(z=0; z<NZ; z++)
+        for(x=0; x<NX; x++)
+            slice[z*NX + x] = G->conc(x, y, z, s);
+    timer_stop(&G->metrics, "Array Copy");
+    
+    vdiff_implicit(NZ, NX,
+                   slice, NX,
+                   &G->diff_v(0, y, 0), NY*NX,
+                   DZ, dt, work);
+    
+    timer_start(&G->metrics, "Array Copy");
+    for(z=0; z<NZ; z++)
+        for(x=0; x<NX; x++)
+            G->conc(x, y, z, s) = slice[z*NX + x];
+    timer_stop(&G->metrics, "Array Copy");
     
 #endif
 }
@@ -145,6 +283,8 @@ void discretize_all_z(fixedgrid_t* G, real_t dt)
 #if DO_Z_DISCRET == 1
     
     int32_t x, y, z, s;
+    uint32_t k, nsub;
+    uint64_t n = 0;
     
     /* Buffers */
     real_t ccol1[NZ];
@@ -157,28 +297,29 @@ void discretize_all_z(fixedgrid_t* G, real_t dt)
     real_t wbound[4];
     real_t dbound[4];
     
-    timer_start(&G->metrics.z_discret);
+    timer_start(&G->metrics, "Z discret");
     
-    #pragma omp for private(z, y, x, s, ccol1, ccol2, wcol, dcol, cbound, wbound, dbound)
+    #pragma omp for private(z, y, x, s, k, nsub, ccol1, ccol2, wcol, dcol, cbound, wbound, dbound) nowait
     for(y=0; y<NY; y++)
     {
-        for(x=0; x<NX; x++)
+        for(s=0; s<NLOOKAT; s++)
         {
-            for(s=0; s<NLOOKAT; s++)
+            for(x=0; x<NX; x++)
             {
-                timer_start(&G->metrics.array_copy);
+                timer_start(&G->metrics, "Array Copy");
                 for(z=0; z<NZ; z++)
                 {
                     ccol1[z] = G->conc(x, y, z, s);
-                    wcol[z]  = G->wind_v(x, y, z);
-                    dcol[z]  = G->diff_h(x, y, z);
+                    wcol[z]  = G->wind_w(x, y, z);
+#if IMPLICIT_Z_DIFFUSION == 1
+                    /* Only advection is explicit */
+                    dcol[z]  = 0.0;
+#else
+                    dcol[z]  = G->diff_v(x, y, z);
+#endif
                 }
-                timer_stop(&G->metrics.array_copy);
+                timer_stop(&G->metrics, "Array Copy");
                 
-                cbound[0] = ccol1[NZ-2];
-                cbound[1] = ccol1[NZ-1];
-                cbound[2] = ccol1[0];
-                cbound[3] = ccol1[1];
                 wbound[0] = wcol[NZ-2];
                 wbound[1] = wcol[NZ-1];
                 wbound[2] = wcol[0];
@@ -188,20 +329,47 @@ void discretize_all_z(fixedgrid_t* G, real_t dt)
                 dbound[2] = dcol[0];
                 dbound[3] = dcol[1];
                 
-                discretize(NZ, 
-                           ccol1, wcol, dcol, 
-                           cbound, wbound, dbound, 
-                           DY, dt, ccol2);
+                /* Subcycle columns that would be unstable over dt */
+                nsub = cfl_substeps(NZ, wcol, dcol, DZ, dt);
+                n += nsub*NZ;
                 
-                timer_start(&G->metrics.array_copy);
+                for(k=0; k<nsub; k++)
+                {
+                    if(k > 0)
+                    {
+                        for(z=0; z<NZ; z++)
+                            ccol1[z] = ccol2[z];
+                    }
+                    
+                    cbound[0] = ccol1[NZ-2];
+                    cbound[1] = ccol1[NZ-1];
+                    cbound[2] = ccol1[0];
+                    cbound[3] = ccol1[1];
+                    
+                    discretize(NZ, 
+                               ccol1, wcol, dcol, 
+                               cbound, wbound, dbound, 
+                               DZ, dt/nsub, ccol2);
+                }
+                
+                timer_start(&G->metrics, "Array Copy");
                 for(z=0; z<NZ; z++)
                     G->conc(x, y, z, s) = ccol2[z];
-                timer_stop(&G->metrics.array_copy);
+                timer_stop(&G->metrics, "Array Copy");
             }
+            
+#if IMPLICIT_Z_DIFFUSION == 1
+            /* Diffuse every column in this xz-slice at once */
+            diffuse_slice_z(G, y, s, dt);
+#endif
         }
     }
     
-    timer_stop(&G->metrics.z_discret);
+    roofline_sweep(G, Z_AXIS, n);
+    
+    trace_barrier();
+    
+    timer_stop(&G->metrics, "Z discret");
     
 #endif
 }
@@ -13,6 +13,12 @@
 #include "fixedgrid.h"
 #include "params.h"
 
+uint32_t discretize_row_x(fixedgrid_t* G, int32_t y, int32_t z, real_t dt);
+
+uint32_t discretize_col_y(fixedgrid_t* G, int32_t x, int32_t z, real_t dt);
+
+void diffuse_slice_z(fixedgrid_t* G, int32_t y, int32_t s, real_t dt);
+
 void discretize_all_x(fixedgrid_t* G, real_t dt);
 
 void discretize_all_y(fixedgrid_t* G, real_t dt);
@@ -0,0 +1,172 @@
+/*
+ *  transpose.c
+ *
+ *  Blocked transposes between the grid and chemistry batches.
+ *
+ *  The chemistry integrates one cell at a time and wants all NSPEC
+ *  species of a cell contiguous, while the transport layouts keep
+ *  runs of cells of one species contiguous.  Gathering a cell one
+ *  species at a time touches NSPEC cache lines per cell.  Instead,
+ *  a run of cells is transposed in TRANSPOSE_TILE x TRANSPOSE_TILE
+ *  tiles: every source line read is used for TRANSPOSE_TILE cells,
+ *  and the tile is small enough to stay in registers and L1.
+ *  This is the job the DMA lists of fetch_chem_buffer do on Cell.
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#include "transpose.h"
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+
+/* Distance between species in one cell */
+#define SPEC_STRIDE (CONC_INDEX(0, 0, 0, 1) - CONC_INDEX(0, 0, 0, 0))
+
+/**
+ * dst[j*dst_stride + i] = src[i*src_stride + j]
+ * for i < rows, j < cols
+ */
+void transpose_to_double(const int rows, const int cols,
+                         real_t *src, const int src_stride,
+                         double *dst, const int dst_stride)
+{
+    int i, j, ii, jj, ni, nj;
+    
+    for(ii=0; ii<rows; ii+=TRANSPOSE_TILE)
+    {
+        ni = MIN(TRANSPOSE_TILE, rows-ii);
+        for(jj=0; jj<cols; jj+=TRANSPOSE_TILE)
+        {
+            nj = MIN(TRANSPOSE_TILE, cols-jj);
+            
+            if(ni == TRANSPOSE_TILE && nj == TRANSPOSE_TILE)
+            {
+                /* Full tile: fixed trip counts unroll and vectorize */
+                for(j=0; j<TRANSPOSE_TILE; j++)
+                {
+                    #pragma omp simd
+                    for(i=0; i<TRANSPOSE_TILE; i++)
+                        dst[(jj+j)*dst_stride + ii+i] = src[(ii+i)*src_stride + jj+j];
+                }
+            }
+            else
+            {
+                for(j=0; j<nj; j++)
+                    for(i=0; i<ni; i++)
+                        dst[(jj+j)*dst_stride + ii+i] = src[(ii+i)*src_stride + jj+j];
+            }
+        }
+    }
+}
+
+/**
+ * dst[j*dst_stride + i] = src[i*src_stride + j]
+ * for i < rows, j < cols
+ */
+void transpose_from_double(const int rows, const int cols,
+                           double *src, const int src_stride,
+                           real_t *dst, const int dst_stride)
+{
+    int i, j, ii, jj, ni, nj;
+    
+    for(ii=0; ii<rows; ii+=TRANSPOSE_TILE)
+    {
+        ni = MIN(TRANSPOSE_TILE, rows-ii);
+        for(jj=0; jj<cols; jj+=TRANSPOSE_TILE)
+        {
+            nj = MIN(TRANSPOSE_TILE, cols-jj);
+            
+            if(ni == TRANSPOSE_TILE && nj == TRANSPOSE_TILE)
+            {
+                /* Full tile: fixed trip counts unroll and vectorize */
+                for(j=0; j<TRANSPOSE_TILE; j++)
+                {
+                    #pragma omp simd
+                    for(i=0; i<TRANSPOSE_TILE; i++)
+                        dst[(jj+j)*dst_stride + ii+i] = src[(ii+i)*src_stride + jj+j];
+                }
+            }
+            else
+            {
+                for(j=0; j<nj; j++)
+                    for(i=0; i<ni; i++)
+                        dst[(jj+j)*dst_stride + ii+i] = src[(ii+i)*src_stride + jj+j];
+            }
+        }
+    }
+}
+
+/**
+ * Number of cells starting at x whose species are
+ * laid out with the same stride, at most n
+ */
+static inline int32_t contiguous_run(int32_t x, int32_t n)
+{
+#if CONC_LAYOUT == LAYOUT_BLOCKED
+    return MIN(CONC_XLANE - x % CONC_XLANE, n);
+#else
+    return n;
+#endif
+}
+
+/**
+ * Copies cells x0 .. x0+n-1 of row (y, z) into blk[n][NSPEC]
+ */
+void gather_cells(fixedgrid_t* G, int32_t x0, int32_t n,
+                  int32_t y, int32_t z, double *blk)
+{
+#if CONC_LAYOUT == LAYOUT_CELL_OUTER
+    
+    int32_t i;
+    real_t *src = &G->conc(x0, y, z, 0);
+    
+    /* Already cell-major */
+    for(i=0; i<n*NSPEC; i++)
+        blk[i] = src[i];
+    
+#else
+    
+    int32_t x, len;
+    
+    for(x=x0; x<x0+n; x+=len)
+    {
+        len = contiguous_run(x, x0+n-x);
+        transpose_to_double(NSPEC, len,
+                            &G->conc(x, y, z, 0), SPEC_STRIDE,
+                            &blk[(x-x0)*NSPEC], NSPEC);
+    }
+    
+#endif
+}
+
+/**
+ * Copies blk[n][NSPEC] back into cells x0 .. x0+n-1 of row (y, z)
+ */
+void scatter_cells(fixedgrid_t* G, int32_t x0, int32_t n,
+                   int32_t y, int32_t z, double *blk)
+{
+#if CONC_LAYOUT == LAYOUT_CELL_OUTER
+    
+    int32_t i;
+    real_t *dst = &G->conc(x0, y, z, 0);
+    
+    /* Already cell-major */
+    for(i=0; i<n*NSPEC; i++)
+        dst[i] = blk[i];
+    
+#else
+    
+    int32_t x, len;
+    
+    for(x=x0; x<x0+n; x+=len)
+    {
+        len = contiguous_run(x, x0+n-x);
+        transpose_from_double(len, NSPEC,
+                              &blk[(x-x0)*NSPEC], NSPEC,
+                              &G->conc(x, y, z, 0), SPEC_STRIDE);
+    }
+    
+#endif
+}
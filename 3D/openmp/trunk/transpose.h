@@ -0,0 +1,51 @@
+/*
+ *  transpose.h
+ *
+ *  Blocked transposes between the grid and chemistry batches.
+ *  Gathers a run of cells across all species into a cell-major
+ *  double-precision buffer with unit-stride reads, and scatters
+ *  it back the same way.
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#ifndef __TRANSPOSE_H__
+#define __TRANSPOSE_H__
+
+/**************************************************
+ * Includes                                       *
+ **************************************************/
+
+#include <stdint.h>
+
+#include "fixedgrid.h"
+#include "params.h"
+
+/**************************************************
+ * Macros                                         *
+ **************************************************/
+
+/* Edge of the square tiles the transposes are done in */
+#define TRANSPOSE_TILE 8
+
+/**************************************************
+ * Function prototypes                            *
+ **************************************************/
+
+void transpose_to_double(const int rows, const int cols,
+                         real_t *src, const int src_stride,
+                         double *dst, const int dst_stride);
+
+void transpose_from_double(const int rows, const int cols,
+                           double *src, const int src_stride,
+                           real_t *dst, const int dst_stride);
+
+void gather_cells(fixedgrid_t* G, int32_t x0, int32_t n,
+                  int32_t y, int32_t z, double *blk);
+
+void scatter_cells(fixedgrid_t* G, int32_t x0, int32_t n,
+                   int32_t y, int32_t z, double *blk);
+
+#endif
@@ -0,0 +1,213 @@
+/*
+ *  unsplit.c
+ *
+ *  Unsplit transport engine.
+ *
+ *  The Strang-split scheme makes five passes over the concentration
+ *  field per timestep (x, y, z, y, x), each a two-stage Runge-Kutta
+ *  step with its own gather and scatter.  This engine takes the same
+ *  two-stage step on the full 3D operator L = Lx + Ly + Lz instead:
+ *      stage  = c + dt*L(c)
+ *      c      = (c + stage + dt*L(stage)) / 2
+ *  so each timestep is two stencil passes.  Each pass is tiled in
+ *  y and z, marching along y so the rows a stencil needs are reused
+ *  from cache, and the x loop of every row is unit-stride.
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "unsplit.h"
+#include "discretize.h"
+#include "cfl.h"
+#include "transport.h"
+#include "trace.h"
+
+/* Species-outer field of the transported species */
+typedef real_t (*field_t)[NZ][NY][NX];
+
+/**
+ * Resets the engine and allocates its buffers if it is enabled
+ */
+void unsplit_init(fixedgrid_t* G)
+{
+    G->unsplit.stage = NULL;
+    G->unsplit.zero = NULL;
+    G->unsplit.passes = 0;
+    
+    if(!G->unsplit.enabled)
+        return;
+    
+    G->unsplit.stage = (real_t*)malloc(sizeof(real_t)*NLOOKAT*NZ*NY*NX);
+    G->unsplit.zero = (real_t*)calloc(NX, sizeof(real_t));
+    if(G->unsplit.stage == NULL || G->unsplit.zero == NULL)
+    {
+        fprintf(stderr, "Couldn't allocate unsplit transport buffers.\n");
+        exit(1);
+    }
+}
+
+/**
+ * Returns x-row (y, z) of species s, gathering it
+ * into buff if rows are not contiguous in memory
+ */
+static inline real_t* conc_row(fixedgrid_t* G, int32_t y, int32_t z, int32_t s,
+                               real_t *buff)
+{
+#if CONC_LAYOUT == LAYOUT_SPECIES_OUTER
+    return &G->conc(0, y, z, s);
+#else
+    int32_t x;
+    
+    for(x=0; x<NX; x++)
+        buff[x] = G->conc(x, y, z, s);
+    return buff;
+#endif
+}
+
+/**
+ * One Runge-Kutta stage over the whole domain.
+ * Stage 1 sets stage = c + dt*L(c).
+ * Stage 2 sets c = (c + stage + dt*L(stage)) / 2 and clips negatives.
+ * Must be called from within a parallel region.
+ */
+static void unsplit_pass(fixedgrid_t* G, field_t stage_buff, real_t dt, int stage)
+{
+    int32_t x, y, z, s, k;
+    int32_t yb, zb, yy, zz;
+    real_t val;
+    
+    /* Neighborhoods of the current row */
+    stencil_t sy, sz;
+    
+    /* Gathered rows for non-contiguous layouts */
+    real_t rows[10][NX];
+    
+    real_t dcdt[NX];
+    
+    #pragma omp for collapse(3) schedule(dynamic) private(x, y, z, s, k, yb, zb, yy, zz, val, sy, sz, rows, dcdt) nowait
+    for(s=0; s<NLOOKAT; s++)
+    {
+        for(zb=0; zb<NZ; zb+=UNSPLIT_ZBLOCK)
+        {
+            for(yb=0; yb<NY; yb+=UNSPLIT_YBLOCK)
+            {
+                for(y=yb; y<yb+UNSPLIT_YBLOCK && y<NY; y++)
+                {
+                    for(z=zb; z<zb+UNSPLIT_ZBLOCK && z<NZ; z++)
+                    {
+                        /* Periodic neighborhoods, as in the split sweeps */
+                        for(k=0; k<5; k++)
+                        {
+                            yy = (y + k - 2 + NY) % NY;
+                            zz = (z + k - 2 + NZ) % NZ;
+                            
+                            if(stage == 1)
+                            {
+                                sy.c[k] = conc_row(G, yy, z, s, rows[k]);
+                                sz.c[k] = (k == 2) ? sy.c[2] : conc_row(G, y, zz, s, rows[5+k]);
+                            }
+                            else
+                            {
+                                sy.c[k] = stage_buff[s][z][yy];
+                                sz.c[k] = stage_buff[s][zz][y];
+                            }
+                            
+                            sy.w[k] = &G->wind_v(0, yy, z);
+                            sy.d[k] = &G->diff_h(0, yy, z);
+                            sz.w[k] = &G->wind_w(0, y, zz);
+#if IMPLICIT_Z_DIFFUSION == 1
+                            sz.d[k] = G->unsplit.zero;
+#else
+                            sz.d[k] = &G->diff_v(0, y, zz);
+#endif
+                        }
+                        
+                        advec_diff_3d(NX, &G->wind_u(0, y, z), &G->diff_h(0, y, z),
+                                      &sy, &sz, dcdt);
+                        
+                        if(stage == 1)
+                        {
+                            for(x=0; x<NX; x++)
+                                stage_buff[s][z][y][x] = sy.c[2][x] + dt*dcdt[x];
+                        }
+                        else
+                        {
+                            for(x=0; x<NX; x++)
+                            {
+                                val = (real_t)0.5 * (G->conc(x, y, z, s) + sy.c[2][x] + dt*dcdt[x]);
+                                G->conc(x, y, z, s) = val < (real_t)0.0 ? (real_t)0.0 : val;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    
+    trace_barrier();
+}
+
+#if IMPLICIT_Z_DIFFUSION == 1
+/**
+ * Backward Euler vertical diffusion over dt.
+ * Must be called from within a parallel region.
+ */
+static void unsplit_vdiff(fixedgrid_t* G, real_t dt)
+{
+    int32_t y, s;
+    
+    #pragma omp for collapse(2) private(y, s) nowait
+    for(s=0; s<NLOOKAT; s++)
+    {
+        for(y=0; y<NY; y++)
+        {
+            diffuse_slice_z(G, y, s, dt);
+        }
+    }
+    
+    trace_barrier();
+}
+#endif
+
+/**
+ * Advances transport by one timestep.
+ * The step is subcycled if the summed Courant and
+ * diffusion numbers of the three axes are too large.
+ */
+void unsplit_step(fixedgrid_t* G)
+{
+    uint32_t k, nsub;
+    real_t adv, diff, dt;
+    field_t stage;
+    
+    adv  = G->cfl.adv_rate[X_AXIS] + G->cfl.adv_rate[Y_AXIS] + G->cfl.adv_rate[Z_AXIS];
+    diff = G->cfl.diff_rate[X_AXIS] + G->cfl.diff_rate[Y_AXIS] + G->cfl.diff_rate[Z_AXIS];
+    nsub = cfl_steps(adv, diff, G->dt);
+    dt = G->dt / nsub;
+    
+    stage = (field_t)G->unsplit.stage;
+    
+    timer_start(&G->metrics, "Unsplit");
+    
+    #pragma omp parallel shared(G, stage, dt, nsub) private(k)
+    {
+        for(k=0; k<nsub; k++)
+        {
+            unsplit_pass(G, stage, dt, 1);
+            unsplit_pass(G, stage, dt, 2);
+        }
+        
+#if IMPLICIT_Z_DIFFUSION == 1
+        unsplit_vdiff(G, G->dt);
+#endif
+    }
+    
+    timer_stop(&G->metrics, "Unsplit");
+    
+    G->unsplit.passes += 2*nsub;
+}
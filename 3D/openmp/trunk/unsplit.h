@@ -0,0 +1,31 @@
+/*
+ *  unsplit.h
+ *
+ *  Unsplit transport engine.
+ *  Advances advection and diffusion along all three axes at once
+ *  with one cache-blocked 3D stencil pass per Runge-Kutta stage.
+ *
+ *  Created by John Linford on 6/23/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#ifndef __UNSPLIT_H__
+#define __UNSPLIT_H__
+
+/**************************************************
+ * Includes                                       *
+ **************************************************/
+
+#include "fixedgrid.h"
+#include "params.h"
+
+/**************************************************
+ * Function prototypes                            *
+ **************************************************/
+
+void unsplit_init(fixedgrid_t* G);
+
+void unsplit_step(fixedgrid_t* G);
+
+#endif
@@ -0,0 +1,465 @@
+/*
+ *  counters.c
+ *
+ *  Hardware performance counters per model phase and thread.
+ *
+ *  Each thread opens one Linux perf event per counter for itself.
+ *  When the timer of a watched phase starts or stops inside a
+ *  parallel region, each thread reads its own counters; outside a
+ *  parallel region the calling thread reads the counters of every
+ *  thread, so phases whose parallel regions are inside the timer
+ *  (chemistry, I/O) are counted on every thread too, including any
+ *  time the other threads spend waiting.  The counts are scaled by
+ *  the time each event was scheduled, in case the kernel multiplexes
+ *  them.  Events that can't be opened (no PMU in a virtual machine,
+ *  perf_event_paranoid too high) are skipped, and if none can be
+ *  opened counting is off.
+ *
+ *  Created by John Linford on 4/8/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <omp.h>
+
+#include "counters.h"
+#include "params.h"
+
+#if HW_COUNTERS == 1
+#include <errno.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+/* One reading of an event */
+typedef struct hwc_sample
+{
+    uint64_t value;
+    uint64_t enabled;
+    uint64_t running;
+} hwc_sample_t;
+
+/* A watched phase */
+typedef struct hwc_phase
+{
+    char* name;
+    uint64_t calls;
+    hwc_sample_t* start;    /* [thread][event] */
+    double* count;          /* [thread][event] */
+} hwc_phase_t;
+
+int hwc_active = 0;
+
+static char* hwc_names[HWC_EVENTS] =
+{
+    "cycles",
+    "instructions",
+    "llc_refs",
+    "llc_misses",
+    "branch_misses",
+    "task_clock"
+};
+
+static int hwc_nthreads = 0;
+static int* hwc_fd = NULL;              /* [thread][event] */
+static int hwc_ok[HWC_EVENTS];          /* Open on every thread */
+static int hwc_nphases = 0;
+static hwc_phase_t hwc_phases[HWC_MAX_PHASES];
+
+#if HW_COUNTERS == 1
+
+/**
+ * Opens one event counting the calling thread's user-space work
+ */
+static int hwc_open(int e)
+{
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    switch(e)
+    {
+    case HWC_CYCLES:        attr.config = PERF_COUNT_HW_CPU_CYCLES;    break;
+    case HWC_INSTRUCTIONS:  attr.config = PERF_COUNT_HW_INSTRUCTIONS;  break;
+    case HWC_LLC_REFS:      attr.config = PERF_COUNT_HW_CACHE_REFERENCES; break;
+    case HWC_LLC_MISSES:    attr.config = PERF_COUNT_HW_CACHE_MISSES;  break;
+    case HWC_BRANCH_MISSES: attr.config = PERF_COUNT_HW_BRANCH_MISSES; break;
+    case HWC_TASK_CLOCK:
+        attr.type = PERF_TYPE_SOFTWARE;
+        attr.config = PERF_COUNT_SW_TASK_CLOCK;
+        break;
+    }
+
+    return syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+#endif
+
+/**
+ * Reads every event of one thread
+ */
+static void hwc_read(int t, hwc_sample_t* s)
+{
+    int e, fd;
+
+    for(e=0; e<HWC_EVENTS; e++)
+    {
+        fd = hwc_fd[t*HWC_EVENTS + e];
+        if(fd < 0 || read(fd, &s[e], sizeof(hwc_sample_t)) != sizeof(hwc_sample_t))
+            memset(&s[e], 0, sizeof(hwc_sample_t));
+    }
+}
+
+/**
+ * Adds the events of one thread since s0 to count
+ */
+static void hwc_accumulate(hwc_sample_t* s0, hwc_sample_t* s1, double* count)
+{
+    int e;
+    uint64_t enabled, running;
+
+    for(e=0; e<HWC_EVENTS; e++)
+    {
+        enabled = s1[e].enabled - s0[e].enabled;
+        running = s1[e].running - s0[e].running;
+        if(running > 0)
+            count[e] += (double)(s1[e].value - s0[e].value) * enabled / running;
+    }
+}
+
+/**
+ * Opens the counters on nthreads OpenMP threads.  Must be
+ * called after the number of threads is set.
+ */
+void hwc_init(int nthreads)
+{
+#if HW_COUNTERS == 1
+    int e, t, nok;
+    int err[HWC_EVENTS];
+    FILE* fptr;
+    int paranoid = -1;
+
+    hwc_nthreads = nthreads;
+    hwc_fd = (int*)malloc(sizeof(int)*nthreads*HWC_EVENTS);
+    if(!hwc_fd)
+    {
+        fprintf(stderr, "Couldn't allocate hardware counters.\n");
+        exit(1);
+    }
+
+    for(e=0; e<HWC_EVENTS; e++)
+    {
+        hwc_ok[e] = 1;
+        err[e] = 0;
+    }
+
+    #pragma omp parallel private(e, t) num_threads(nthreads)
+    {
+        t = omp_get_thread_num();
+        for(e=0; e<HWC_EVENTS; e++)
+        {
+            hwc_fd[t*HWC_EVENTS + e] = hwc_open(e);
+            if(hwc_fd[t*HWC_EVENTS + e] < 0)
+            {
+                #pragma omp critical
+                {
+                    hwc_ok[e] = 0;
+                    err[e] = errno;
+                }
+            }
+        }
+    }
+
+    /* Only keep events open on every thread */
+    nok = 0;
+    for(e=0; e<HWC_EVENTS; e++)
+    {
+        if(hwc_ok[e])
+        {
+            ++nok;
+            continue;
+        }
+        for(t=0; t<nthreads; t++)
+        {
+            if(hwc_fd[t*HWC_EVENTS + e] >= 0)
+                close(hwc_fd[t*HWC_EVENTS + e]);
+            hwc_fd[t*HWC_EVENTS + e] = -1;
+        }
+    }
+
+    printf("Hardware counters:");
+    for(e=0; e<HWC_EVENTS; e++)
+        if(hwc_ok[e])
+            printf(" %s", hwc_names[e]);
+    if(nok == 0)
+        printf(" none");
+    printf("\n");
+
+    for(e=0; e<HWC_EVENTS; e++)
+    {
+        if(!hwc_ok[e])
+            printf("    %s unavailable: %s\n", hwc_names[e], strerror(err[e]));
+    }
+    if(nok < HWC_EVENTS)
+    {
+        if((fptr = fopen("/proc/sys/kernel/perf_event_paranoid", "r")) != NULL)
+        {
+            if(fscanf(fptr, "%d", &paranoid) != 1)
+                paranoid = -1;
+            fclose(fptr);
+        }
+        if(paranoid > 2)
+            printf("    perf_event_paranoid is %d; counting needs 2 or less\n", paranoid);
+    }
+
+    hwc_active = nok > 0;
+#else
+    hwc_nthreads = nthreads;
+    hwc_active = 0;
+#endif
+}
+
+/**
+ * Counts events while any timer called name runs
+ */
+void hwc_watch(char* name)
+{
+    hwc_phase_t* p;
+
+    if(!hwc_active || hwc_nphases >= HWC_MAX_PHASES)
+        return;
+
+    p = &hwc_phases[hwc_nphases];
+    p->name = name;
+    p->calls = 0;
+    p->start = (hwc_sample_t*)malloc(sizeof(hwc_sample_t)*hwc_nthreads*HWC_EVENTS);
+    p->count = (double*)calloc(hwc_nthreads*HWC_EVENTS, sizeof(double));
+    if(!p->start || !p->count)
+    {
+        fprintf(stderr, "Couldn't allocate hardware counters.\n");
+        exit(1);
+    }
+
+    ++hwc_nphases;
+}
+
+/**
+ * Returns the phase called name, or NULL
+ */
+static hwc_phase_t* hwc_find(char* name)
+{
+    int i;
+
+    for(i=0; i<hwc_nphases; i++)
+        if(hwc_phases[i].name == name || !strcmp(hwc_phases[i].name, name))
+            return &hwc_phases[i];
+
+    return NULL;
+}
+
+/**
+ * Reads the counters as the timer called name starts
+ */
+void hwc_start(char* name)
+{
+    hwc_phase_t* p;
+    int tid;
+
+    if((p = hwc_find(name)) == NULL)
+        return;
+
+    if(omp_in_parallel())
+    {
+        tid = omp_get_thread_num();
+        if(tid < hwc_nthreads)
+            hwc_read(tid, &p->start[tid*HWC_EVENTS]);
+    }
+    else
+    {
+        for(tid=0; tid<hwc_nthreads; tid++)
+            hwc_read(tid, &p->start[tid*HWC_EVENTS]);
+    }
+}
+
+/**
+ * Reads the counters as the timer called name stops
+ * and adds the events since it started
+ */
+void hwc_stop(char* name)
+{
+    hwc_phase_t* p;
+    hwc_sample_t now[HWC_EVENTS];
+    int tid;
+
+    if((p = hwc_find(name)) == NULL)
+        return;
+
+    if(omp_in_parallel())
+    {
+        tid = omp_get_thread_num();
+        if(tid < hwc_nthreads)
+        {
+            hwc_read(tid, now);
+            hwc_accumulate(&p->start[tid*HWC_EVENTS], now, &p->count[tid*HWC_EVENTS]);
+        }
+        if(tid == 0)
+            ++p->calls;
+    }
+    else
+    {
+        for(tid=0; tid<hwc_nthreads; tid++)
+        {
+            hwc_read(tid, now);
+            hwc_accumulate(&p->start[tid*HWC_EVENTS], now, &p->count[tid*HWC_EVENTS]);
+        }
+        ++p->calls;
+    }
+}
+
+/**
+ * Sums the events of phase p over all threads
+ */
+static void hwc_total(hwc_phase_t* p, double* total)
+{
+    int e, t;
+
+    for(e=0; e<HWC_EVENTS; e++)
+    {
+        total[e] = 0.0;
+        for(t=0; t<hwc_nthreads; t++)
+            total[e] += p->count[t*HWC_EVENTS + e];
+    }
+}
+
+/**
+ * Returns a/b, or -1 if either event is unavailable
+ */
+static double hwc_ratio(double a, int ea, double b, int eb)
+{
+    if((ea >= 0 && !hwc_ok[ea]) || (eb >= 0 && !hwc_ok[eb]) || b <= 0.0)
+        return -1.0;
+    return a / b;
+}
+
+/**
+ * Derived metrics of one set of counts:
+ * IPC, LLC miss rate, LLC misses, branch misses
+ * and memory bytes per cell per call
+ */
+static void hwc_derive(double* c, double cellcalls, double* d)
+{
+    d[0] = hwc_ratio(c[HWC_INSTRUCTIONS], HWC_INSTRUCTIONS, c[HWC_CYCLES], HWC_CYCLES);
+    d[1] = hwc_ratio(c[HWC_LLC_MISSES], HWC_LLC_MISSES, c[HWC_LLC_REFS], HWC_LLC_REFS);
+    d[2] = hwc_ratio(c[HWC_LLC_MISSES], HWC_LLC_MISSES, cellcalls, -1);
+    d[3] = hwc_ratio(c[HWC_BRANCH_MISSES], HWC_BRANCH_MISSES, cellcalls, -1);
+    d[4] = hwc_ratio(HWC_LINE_SIZE*c[HWC_LLC_MISSES], HWC_LLC_MISSES, cellcalls, -1);
+}
+
+/**
+ * Displays the counts and derived metrics of each phase,
+ * summed over all threads.  cells is the number of grid
+ * cells each call of a phase processes.
+ */
+void print_hwc(uint64_t cells)
+{
+    int i, e;
+    double c[HWC_EVENTS], d[5];
+
+    if(!hwc_active)
+        return;
+
+    printf("\n===== Hardware counters (%d threads) =====\n", hwc_nthreads);
+    printf("%-12s %8s %12s %12s %6s %12s %12s %7s %9s %9s %9s %9s\n", "Phase", "Calls", "Cycles", "Instr",
+           "IPC", "LLC refs", "LLC misses", "Miss%", "Miss/cell", "Br/cell", "B/cell", "CPU sec");
+    for(i=0; i<hwc_nphases; i++)
+    {
+        hwc_total(&hwc_phases[i], c);
+        hwc_derive(c, (double)cells*hwc_phases[i].calls, d);
+        printf("%-12s %8lu", hwc_phases[i].name, (unsigned long)hwc_phases[i].calls);
+        for(e=0; e<=HWC_LLC_MISSES; e++)
+        {
+            if(hwc_ok[e]) printf(" %12.4e", c[e]);
+            else          printf(" %12s", "-");
+            if(e == HWC_INSTRUCTIONS)
+            {
+                if(d[0] >= 0) printf(" %6.2f", d[0]);
+                else          printf(" %6s", "-");
+            }
+        }
+        if(d[1] >= 0) printf(" %6.1f%%", 100.0*d[1]);
+        else          printf(" %7s", "-");
+        for(e=2; e<5; e++)
+        {
+            if(d[e] >= 0) printf(" %9.3f", d[e]);
+            else          printf(" %9s", "-");
+        }
+        if(hwc_ok[HWC_TASK_CLOCK]) printf(" %9.3f\n", c[HWC_TASK_CLOCK]*1.0e-9);
+        else                       printf(" %9s\n", "-");
+    }
+}
+
+/**
+ * Writes one row of counts and derived metrics
+ */
+static void hwc_csv_row(FILE* fptr, char* name, char* thread, uint64_t calls, double* c, double cellcalls)
+{
+    int e;
+    double d[5];
+
+    hwc_derive(c, cellcalls, d);
+
+    fprintf(fptr, "%s,%s,%lu,", name, thread, (unsigned long)calls);
+    for(e=0; e<HWC_EVENTS; e++)
+    {
+        if(hwc_ok[e]) fprintf(fptr, "%.0f,", c[e]);
+        else          fprintf(fptr, ",");
+    }
+    for(e=0; e<5; e++)
+    {
+        if(d[e] >= 0) fprintf(fptr, "%g,", d[e]);
+        else          fprintf(fptr, ",");
+    }
+    fprintf(fptr, "\n");
+}
+
+/**
+ * Writes the counts of each phase, in total and per thread,
+ * to an open metrics CSV file
+ */
+void write_hwc_to_csv_file(FILE* fptr, uint64_t cells)
+{
+    int i, e, t;
+    double c[HWC_EVENTS];
+    char thread[16];
+    hwc_phase_t* p;
+
+    if(!hwc_active)
+        return;
+
+    fprintf(fptr, "Counters,Thread,Calls,");
+    for(e=0; e<HWC_EVENTS; e++)
+        fprintf(fptr, "%s,", hwc_names[e]);
+    fprintf(fptr, "IPC,LLC miss rate,LLC misses/cell,Branch misses/cell,Memory bytes/cell,\n");
+
+    for(i=0; i<hwc_nphases; i++)
+    {
+        p = &hwc_phases[i];
+        hwc_total(p, c);
+        hwc_csv_row(fptr, p->name, "all", p->calls, c, (double)cells*p->calls);
+        for(t=0; t<hwc_nthreads; t++)
+        {
+            sprintf(thread, "%d", t);
+            hwc_csv_row(fptr, p->name, thread, p->calls, &p->count[t*HWC_EVENTS], (double)cells*p->calls);
+        }
+    }
+    fprintf(fptr, ",\n,\n");
+}
@@ -0,0 +1,65 @@
+/*
+ *  counters.h
+ *
+ *  Hardware performance counters per model phase and thread.
+ *  Counters are read when the timer of a watched phase
+ *  starts and stops (see timer_start, timer_stop).
+ *
+ *  Created by John Linford on 4/8/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#ifndef __COUNTERS_H__
+#define __COUNTERS_H__
+
+/**************************************************
+ * Includes                                       *
+ **************************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+
+/**************************************************
+ * Macros                                         *
+ **************************************************/
+
+/* Counted events */
+#define HWC_CYCLES        0
+#define HWC_INSTRUCTIONS  1
+#define HWC_LLC_REFS      2
+#define HWC_LLC_MISSES    3
+#define HWC_BRANCH_MISSES 4
+#define HWC_TASK_CLOCK    5
+#define HWC_EVENTS        6
+
+/* Most phases watched */
+#define HWC_MAX_PHASES  8
+
+/* Bytes moved from memory per LLC miss */
+#define HWC_LINE_SIZE   64
+
+/**************************************************
+ * Globals                                        *
+ **************************************************/
+
+/* Nonzero once counters are open */
+extern int hwc_active;
+
+/**************************************************
+ * Function Prototypes                            *
+ **************************************************/
+
+void hwc_init(int nthreads);
+
+void hwc_watch(char* name);
+
+void hwc_start(char* name);
+
+void hwc_stop(char* name);
+
+void print_hwc(uint64_t cells);
+
+void write_hwc_to_csv_file(FILE* fptr, uint64_t cells);
+
+#endif
@@ -13,68 +13,93 @@
 
 #include "fileio.h"
 #include "timer.h"
+#include "counters.h"
 #include "params.h"
 #include "saprc99_Monitor.h"
+#include "chemistry.h"
+#include "roofline.h"
 
-void write_conc(fixedgrid_t* G, uint32_t iter, uint32_t proc)
+/* Value of a field at one cell */
+typedef double (*cell_value_t)(fixedgrid_t* G, void* field, uint32_t x, uint32_t y, uint32_t z);
+
+/**
+ * Writes one value per cell, with the coordinates of the cell center,
+ * to OUTPUT_DIR/OUT_solution_<name>_<nprocs>_<iter>.<proc>
+ */
+static void write_field(fixedgrid_t* G, char* name, cell_value_t value, void* field, uint32_t iter, uint32_t proc)
 {
-    uint32_t x, y, z, s;
-    uint32_t spc_ind;
+    uint32_t x, y, z;
     float coord_x, coord_y, coord_z;
     FILE *fptr;
     char fname[255];
     
-    timer_start(&G->metrics.file_io);
+    /* Build file name */
+    sprintf(fname, "%s/OUT_solution_%s_%02d_%05d.%03d", OUTPUT_DIR, name, G->nprocs, iter, proc);
     
-    for(s=0; s<NMONITOR; s++)
+    /* Write to new file */
+    if((fptr = (FILE*)fopen(fname, "w")) == NULL)
     {
-        spc_ind = MONITOR[s];
-        
-        /* Build file name */
-        sprintf(fname, "%s/OUT_solution_%s_%02d_%05d.%03d", OUTPUT_DIR, SPC_NAMES[spc_ind], G->nprocs, iter, proc);
-        
-        /* Write to new file */
-        if((fptr = (FILE*)fopen(fname, "w")) != NULL)
+        fprintf(stderr, "Couldn't open file \"%s\" for writing.", fname);
+        exit(1);
+    }
+    
+    for(z=0; z<NZ; z++)
+    {
+        for(y=0; y<NY; y++)
         {
-            for(z=0; z<NZ; z++)
+            for(x=0; x<NX; x++)
             {
-                for(y=0; y<NY; y++)
-                {
-                    for(x=0; x<NX; x++)
-                    {
-                        coord_x = DX*x + DX*0.5;
-                        coord_y = DY*y + DY*0.5;
-                        coord_z = DZ*z + DZ*0.5;
-                        fprintf(fptr, "%22.16E %22.16E %22.16E %22.16E\n", 
-                                coord_x, coord_y, coord_z, 
-                                G->conc(x, y, z, spc_ind));
-                    }
-                }
+                coord_x = DX*x + DX*0.5;
+                coord_y = DY*y + DY*0.5;
+                coord_z = DZ*z + DZ*0.5;
+                fprintf(fptr, "%22.16E %22.16E %22.16E %22.16E\n", 
+                        coord_x, coord_y, coord_z, 
+                        value(G, field, x, y, z));
             }
-            fclose(fptr);
         }
-        else
-        {
-            fprintf(stderr, "Couldn't open file \"%s\" for writing.", fname);
-            exit(1);
-        }
-    }    
-    timer_stop(&G->metrics.file_io);
+    }
+    fclose(fptr);
 }
 
-void write_metrics_to_csv_file( metrics_t* m, FILE* fptr)
+/**
+ * Concentration of the species *field
+ */
+static double conc_value(fixedgrid_t* G, void* field, uint32_t x, uint32_t y, uint32_t z)
 {
-    uint32_t i;
-    
-    stopwatch_t* tptr = (stopwatch_t*)m;
+    return G->conc(x, y, z, *(uint32_t*)field);
+}
+
+#if DO_CHEMISTRY == 1 && CHEM_COST_MAP == 1
+/**
+ * Value of the [NZ][NY][NX] integer field at field
+ */
+static double cell_int_value(fixedgrid_t* G, void* field, uint32_t x, uint32_t y, uint32_t z)
+{
+    return (double)((uint32_t*)field)[(z*NY + y)*NX + x];
+}
+#endif
+
+void write_conc(fixedgrid_t* G, uint32_t iter, uint32_t proc)
+{
+    uint32_t s;
+    uint32_t spc_ind;
     
-    fprintf(fptr, "Timer,%s,\n", m->name);
+    timer_start(&G->metrics, "File I/O");
     
-    for(i=0; i<NUM_TIMERS; i++, tptr++)
+    for(s=0; s<NMONITOR; s++)
     {
-        fprintf(fptr, "%s,%f,\n", timer_names[i], tptr->elapsed);
-    }
-    fprintf(fptr, ",\n,\n");
+        spc_ind = MONITOR[s];
+        write_field(G, SPC_NAMES[spc_ind], conc_value, &spc_ind, iter, proc);
+    }    
+    
+#if DO_CHEMISTRY == 1 && CHEM_COST_MAP == 1
+    /* Chemistry cost of each cell so far */
+    write_field(G, "NSTP", cell_int_value, &G->cost_nstp(0, 0, 0), iter, proc);
+    write_field(G, "NREJ", cell_int_value, &G->cost_nrej(0, 0, 0), iter, proc);
+    write_field(G, "USEC", cell_int_value, &G->cost_usec(0, 0, 0), iter, proc);
+#endif
+    
+    timer_stop(&G->metrics, "File I/O");
 }
 
 void write_metrics_as_csv(fixedgrid_t* G, char* platform)
@@ -84,7 +109,7 @@ void write_metrics_as_csv(fixedgrid_t* G, char* platform)
     FILE* fptr;
     char fname[255];
     
-    steps = (G->tend - G->tstart) / G->dt;
+    steps = G->steps;
     
     // Build file name
     sprintf(fname, "%s/METRICS_%03d_%02d.csv", OUTPUT_DIR, RUN_ID, G->nprocs);
@@ -104,6 +129,9 @@ void write_metrics_as_csv(fixedgrid_t* G, char* platform)
         
         // Write metrics
         write_metrics_to_csv_file(&G->metrics, fptr);
+        write_hwc_to_csv_file(fptr, NX*NY*NZ);
+        write_chem_cost_to_csv_file(G, fptr);
+        write_roofline_to_csv_file(G, fptr);
         
         fclose(fptr);
     }
@@ -26,6 +26,4 @@ void write_metrics_as_csv(fixedgrid_t* G, char* platform);
 
 void write_conc(fixedgrid_t* G, uint32_t iter, uint32_t proc);
 
-void print_metrics( metrics_t* m);
-
 #endif
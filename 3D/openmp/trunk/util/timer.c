@@ -1,8 +1,15 @@
 /*
  *  timer.c
- *  
+ *
  *  Common timer functionality
  *
+ *  Timers are created by name the first time they start, as
+ *  children of the timer running at the time, so the registry is
+ *  a call tree of the timed regions.  Only the master thread
+ *  (thread 0) records times: inside a parallel region the other
+ *  threads only pass the region to the hardware counters and the
+ *  trace, which are per thread, so timing takes no locks.
+ *
  *  Created by John Linford on 4/8/08.
  *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
  *
@@ -10,59 +17,205 @@
 
 #include <stdio.h>
 #include <string.h>
-#include <sys/time.h>
+#include <time.h>
+#include <omp.h>
 
 #include "timer.h"
+#include "counters.h"
+#include "trace.h"
 
-/* Human-readable labels for timers.
- * MUST appear in the same order as the timer declarations
- * in the metrics_t type definition.
+/**
+ * Returns the seconds since the first call, from the monotonic clock
  */
-char* timer_names[NUM_TIMERS] = 
-{
-    "Wallclock  ",
-    "Array Init ",
-    "Array Copy ",
-    "File I/O   ",
-    "X discret  ",
-    "Y discret  ",
-    "Z discret  ",
-    "Chemistry  "
-};
-
-float elapsed_time()
+double elapsed_time()
 {
-	static int sec = -1;
-	struct timeval tv;
-	gettimeofday(&tv, 0);
-	if(sec < 0) sec = tv.tv_sec;
-	return (tv.tv_sec - sec) + 1.0e-6*tv.tv_usec;
+    static time_t sec = -1;
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    if(sec < 0) sec = ts.tv_sec;
+    return (ts.tv_sec - sec) + 1.0e-9*ts.tv_nsec;
 }
 
 void metrics_init( metrics_t* m, char* name)
 {
-    int i;
-    
-    stopwatch_t* tptr = (stopwatch_t*)m;
-    
-    for(i=0; i<NUM_TIMERS; i++, tptr++)
+    m->ntimers = 0;
+    m->current = -1;
+
+    strncpy(m->name, name, sizeof(m->name)-1);
+    m->name[sizeof(m->name)-1] = 0;
+}
+
+/**
+ * Returns the child of the current timer called name,
+ * creating it if needed, or -1 if the registry is full
+ */
+static int32_t timer_child( metrics_t* m, char* name)
+{
+    int32_t i;
+    stopwatch_t* t;
+
+    for(i=0; i<m->ntimers; i++)
     {
-        tptr->start = 0.0;
-        tptr->elapsed = 0.0;
+        if(m->timers[i].parent == m->current && !strcmp(m->timers[i].name, name))
+            return i;
+    }
+
+    if(m->ntimers >= MAX_TIMERS)
+    {
+        fprintf(stderr, "Too many timers (MAX_TIMERS %d): %s not timed.\n", MAX_TIMERS, name);
+        return -1;
+    }
+
+    t = &m->timers[m->ntimers];
+    strncpy(t->name, name, TIMER_NAME_LEN-1);
+    t->name[TIMER_NAME_LEN-1] = 0;
+    t->parent = m->current;
+    t->depth = m->current < 0 ? 0 : m->timers[m->current].depth + 1;
+    t->calls = 0;
+    t->elapsed = 0.0;
+    t->min = 0.0;
+    t->max = 0.0;
+
+    return m->ntimers++;
+}
+
+void timer_start( metrics_t* m, char* name)
+{
+    int32_t i;
+
+    if(omp_get_thread_num() == 0)
+    {
+        if((i = timer_child(m, name)) >= 0)
+        {
+            m->current = i;
+            m->timers[i].start = elapsed_time();
+        }
+    }
+
+    if(hwc_active) hwc_start(name);
+    if(trace_on) trace_watch_begin(name);
+}
+
+void timer_stop( metrics_t* m, char* name)
+{
+    int32_t i;
+    double dt;
+    stopwatch_t* t;
+
+    if(trace_on) trace_watch_end(name);
+    if(hwc_active) hwc_stop(name);
+
+    if(omp_get_thread_num() != 0)
+        return;
+
+    /* Close the innermost running timer of this name */
+    for(i=m->current; i>=0 && strcmp(m->timers[i].name, name); i=m->timers[i].parent);
+    if(i < 0)
+        return;
+
+    t = &m->timers[i];
+    dt = elapsed_time() - t->start;
+    if(t->calls == 0 || dt < t->min) t->min = dt;
+    if(t->calls == 0 || dt > t->max) t->max = dt;
+    t->elapsed += dt;
+    ++t->calls;
+
+    m->current = t->parent;
+}
+
+/**
+ * Returns the total time of every timer called name
+ */
+double timer_total( metrics_t* m, char* name)
+{
+    int32_t i;
+    double total = 0.0;
+
+    for(i=0; i<m->ntimers; i++)
+    {
+        if(!strcmp(m->timers[i].name, name))
+            total += m->timers[i].elapsed;
+    }
+
+    return total;
+}
+
+/**
+ * Displays timer i and the timers inside it
+ */
+static void print_timer( metrics_t* m, int32_t i)
+{
+    int32_t j;
+    stopwatch_t* t = &m->timers[i];
+
+    printf("%*s%-*s: %12.6f %10lu %12.4e %12.4e %12.4e\n",
+           2*t->depth, "", TIMER_NAME_LEN - 2*t->depth, t->name, t->elapsed,
+           (unsigned long)t->calls, t->calls ? t->elapsed / t->calls : 0.0, t->min, t->max);
+
+    for(j=i+1; j<m->ntimers; j++)
+    {
+        if(m->timers[j].parent == i)
+            print_timer(m, j);
     }
-    
-    strncpy(m->name, name, 56);
 }
 
 void print_metrics( metrics_t* m)
 {
-    int i;
-    stopwatch_t* tptr = (stopwatch_t*)m;
-    
+    int32_t i;
+
     printf("\n===== %s =====\n", m->name);
-    
-    for(i=0; i<NUM_TIMERS; i++, tptr++)
+    printf("%-*s  %12s %10s %12s %12s %12s\n", TIMER_NAME_LEN, "Timer (sec)", "Total", "Calls", "Mean", "Min", "Max");
+
+    for(i=0; i<m->ntimers; i++)
+    {
+        if(m->timers[i].parent < 0)
+            print_timer(m, i);
+    }
+}
+
+/**
+ * Writes the path of timer i, e.g. Wallclock/X discret
+ */
+static void write_timer_path( metrics_t* m, int32_t i, FILE* fptr)
+{
+    if(m->timers[i].parent >= 0)
+    {
+        write_timer_path(m, m->timers[i].parent, fptr);
+        fprintf(fptr, "/");
+    }
+    fprintf(fptr, "%s", m->timers[i].name);
+}
+
+/**
+ * Writes timer i and the timers inside it
+ */
+static void write_timer_csv( metrics_t* m, int32_t i, FILE* fptr)
+{
+    int32_t j;
+    stopwatch_t* t = &m->timers[i];
+
+    write_timer_path(m, i, fptr);
+    fprintf(fptr, ",%d,%lu,%f,%e,%e,\n", t->depth, (unsigned long)t->calls, t->elapsed, t->min, t->max);
+
+    for(j=i+1; j<m->ntimers; j++)
+    {
+        if(m->timers[j].parent == i)
+            write_timer_csv(m, j, fptr);
+    }
+}
+
+void write_metrics_to_csv_file( metrics_t* m, FILE* fptr)
+{
+    int32_t i;
+
+    fprintf(fptr, "Timer,%s,\n", m->name);
+    fprintf(fptr, "Path,Depth,Calls,Total,Min,Max,\n");
+
+    for(i=0; i<m->ntimers; i++)
     {
-        printf("%s: %f\n", timer_names[i], tptr->elapsed);
+        if(m->timers[i].parent < 0)
+            write_timer_csv(m, i, fptr);
     }
+    fprintf(fptr, ",\n,\n");
 }
@@ -15,73 +15,70 @@
  * Includes                                       *
  **************************************************/
 
+#include <stdio.h>
 #include <stdint.h>
 
 /**************************************************
  * Macros                                         *
  **************************************************/
 
-#define NUM_TIMERS 8
+/* Most timers in one registry */
+#define MAX_TIMERS 64
+
+/* Longest timer name */
+#define TIMER_NAME_LEN 32
 
 /**************************************************
  * Data types                                     *
  **************************************************/
 
-/* Stopwtch for gathering metrics */
+/* A named region timed on the master thread.
+ * Regions nest: a timer started while another is
+ * running is a different timer from one of the same
+ * name started elsewhere. */
 typedef struct stopwatch
 {
-    float start;
-    float elapsed;
+    char name[TIMER_NAME_LEN];
+    int32_t parent;         /* Enclosing timer, or -1 */
+    int32_t depth;
+    uint64_t calls;
+    double start;           /* Seconds since the clock was first read */
+    double elapsed;         /* Total of all calls */
+    double min;             /* Shortest call */
+    double max;             /* Longest call */
 } stopwatch_t;
 
-/* Thread metrics */
+/* Timer registry */
 typedef struct metrics
 {
-    stopwatch_t wallclock;
-    stopwatch_t array_init;
-    stopwatch_t array_copy;
-    stopwatch_t file_io;
-    stopwatch_t x_discret;
-    stopwatch_t y_discret;
-    stopwatch_t z_discret;
-    stopwatch_t chem;
-    char name[128-NUM_TIMERS*sizeof(stopwatch_t)];    
+    char name[128];
+    int32_t ntimers;
+    int32_t current;        /* Innermost running timer, or -1 */
+    stopwatch_t timers[MAX_TIMERS];
 } metrics_t;
 
-/**************************************************
- * Globals                                        *
- **************************************************/
-
-extern char* timer_names[NUM_TIMERS];
-
 /**************************************************
  * Function Prototypes                            *
  **************************************************/
 
-float elapsed_time();
+double elapsed_time();
 
 void metrics_init( metrics_t* m, char* name);
 
+void timer_start( metrics_t* m, char* name);
+
+void timer_stop( metrics_t* m, char* name);
+
+double timer_total( metrics_t* m, char* name);
+
+void print_metrics( metrics_t* m);
+
+void write_metrics_to_csv_file( metrics_t* m, FILE* fptr);
+
 /**************************************************
  * Inline fuctions                                *
  **************************************************/
 
-static inline void timer_start( stopwatch_t* t)
-{
-	#pragma omp critical
-	{
-		t->start = elapsed_time();
-	}
-}
-
-static inline void timer_stop( stopwatch_t* t)
-{
-	#pragma omp critical
-	{
-		t->elapsed += elapsed_time() - t->start;
-	}
-}
-
 static inline int64_t year2sec(int32_t years)
 {
     return years * 31556926;
@@ -0,0 +1,218 @@
+/*
+ *  trace.c
+ *
+ *  Timeline of the model phases on every thread.
+ *
+ *  Each thread records complete events (name, start, duration and
+ *  timestep) in its own ring buffer of TRACE_EVENTS events, so
+ *  recording takes no locks and a long run keeps its latest events.
+ *  Events are opened and closed with trace_begin and trace_end, or
+ *  by the timers of watched phases.  At the end of the run the
+ *  buffers are written as a Chrome trace-event JSON file, one track
+ *  per thread.  Time a thread spends in a traced barrier is recorded
+ *  as "Wait"; gaps in a track are time spent outside any parallel
+ *  region (e.g. waiting for serial work on thread 0).
+ *
+ *  Created by John Linford on 4/8/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <omp.h>
+
+#include "trace.h"
+#include "params.h"
+
+/* A completed event */
+typedef struct trace_event
+{
+    char* name;
+    double start;
+    double dur;
+    int32_t step;
+} trace_event_t;
+
+/* Events of one thread */
+typedef struct trace_buffer
+{
+    trace_event_t* events;
+    uint64_t count;                 /* Events recorded, including overwritten */
+    int depth;
+    char* open_name[TRACE_DEPTH];
+    double open_start[TRACE_DEPTH];
+    char pad[64];                   /* Keeps threads off each other's cache lines */
+} trace_buffer_t;
+
+int trace_on = 0;
+int32_t trace_step = 0;
+
+static int trace_nthreads = 0;
+static double trace_t0;
+static trace_buffer_t* trace_buf = NULL;
+static int trace_nphases = 0;
+static char* trace_phases[TRACE_MAX_PHASES];
+
+/**
+ * Allocates a buffer per thread and starts tracing
+ */
+void trace_init(int nthreads)
+{
+    int t;
+
+    trace_nthreads = nthreads;
+    trace_buf = (trace_buffer_t*)malloc(sizeof(trace_buffer_t)*nthreads);
+    if(!trace_buf)
+    {
+        fprintf(stderr, "Couldn't allocate trace buffers.\n");
+        exit(1);
+    }
+
+    for(t=0; t<nthreads; t++)
+    {
+        trace_buf[t].events = (trace_event_t*)malloc(sizeof(trace_event_t)*TRACE_EVENTS);
+        if(!trace_buf[t].events)
+        {
+            fprintf(stderr, "Couldn't allocate trace buffers.\n");
+            exit(1);
+        }
+        trace_buf[t].count = 0;
+        trace_buf[t].depth = 0;
+    }
+
+    trace_t0 = omp_get_wtime();
+    trace_on = 1;
+}
+
+/**
+ * Traces every timer called name
+ */
+void trace_watch(char* name)
+{
+    if(!trace_on || trace_nphases >= TRACE_MAX_PHASES)
+        return;
+
+    trace_phases[trace_nphases++] = name;
+}
+
+/**
+ * Returns TRUE if timers called name are traced
+ */
+static int trace_find(char* name)
+{
+    int i;
+
+    for(i=0; i<trace_nphases; i++)
+        if(trace_phases[i] == name || !strcmp(trace_phases[i], name))
+            return 1;
+
+    return 0;
+}
+
+void trace_watch_begin(char* name)
+{
+    if(trace_find(name))
+        trace_push(name);
+}
+
+void trace_watch_end(char* name)
+{
+    if(trace_find(name))
+        trace_pop();
+}
+
+/**
+ * Opens an event on the calling thread
+ */
+void trace_push(char* name)
+{
+    int tid = omp_get_thread_num();
+    trace_buffer_t* b;
+
+    if(tid >= trace_nthreads)
+        return;
+
+    b = &trace_buf[tid];
+    if(b->depth < TRACE_DEPTH)
+    {
+        b->open_name[b->depth] = name;
+        b->open_start[b->depth] = omp_get_wtime();
+    }
+    ++b->depth;
+}
+
+/**
+ * Closes the innermost open event on the calling thread
+ */
+void trace_pop()
+{
+    int tid = omp_get_thread_num();
+    trace_buffer_t* b;
+    trace_event_t* e;
+
+    if(tid >= trace_nthreads)
+        return;
+
+    b = &trace_buf[tid];
+    if(b->depth == 0)
+        return;
+    if(--b->depth >= TRACE_DEPTH)
+        return;
+
+    e = &b->events[b->count % TRACE_EVENTS];
+    e->name = b->open_name[b->depth];
+    e->start = b->open_start[b->depth];
+    e->dur = omp_get_wtime() - e->start;
+    e->step = trace_step;
+    ++b->count;
+}
+
+/**
+ * Writes the events of every thread to a Chrome trace-event file
+ */
+void write_trace(int nprocs)
+{
+    FILE* fptr;
+    char fname[255];
+    int t;
+    uint64_t i, first, dropped;
+    trace_event_t* e;
+
+    if(!trace_on)
+        return;
+    trace_on = 0;
+
+    sprintf(fname, "%s/TRACE_%03d_%02d.json", OUTPUT_DIR, RUN_ID, nprocs);
+
+    if((fptr = fopen(fname, "w")) == NULL)
+    {
+        fprintf(stderr, "Couldn't open file \"%s\" for writing.\n", fname);
+        return;
+    }
+
+    fprintf(fptr, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+    fprintf(fptr, "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 0, \"args\": {\"name\": \"fixedgrid\"}}");
+    dropped = 0;
+    for(t=0; t<trace_nthreads; t++)
+    {
+        fprintf(fptr, ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": %d, \"args\": {\"name\": \"Thread %d\"}}", t, t);
+
+        first = trace_buf[t].count > TRACE_EVENTS ? trace_buf[t].count - TRACE_EVENTS : 0;
+        dropped += first;
+        for(i=first; i<trace_buf[t].count; i++)
+        {
+            e = &trace_buf[t].events[i % TRACE_EVENTS];
+            fprintf(fptr, ",\n{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 0, \"tid\": %d, \"ts\": %.3f, \"dur\": %.3f, \"args\": {\"step\": %d}}",
+                    e->name, t, (e->start - trace_t0)*1.0e6, e->dur*1.0e6, e->step);
+        }
+    }
+    fprintf(fptr, "\n]}\n");
+    fclose(fptr);
+
+    printf("Trace stored to file: %s", fname);
+    if(dropped > 0)
+        printf(" (%lu oldest events overwritten)", (unsigned long)dropped);
+    printf("\n");
+}
@@ -0,0 +1,86 @@
+/*
+ *  trace.h
+ *
+ *  Timeline of the model phases on every thread, written
+ *  as Chrome trace events (chrome://tracing, Perfetto).
+ *
+ *  Created by John Linford on 4/8/08.
+ *  Copyright 2008 Transatlantic Giraffe. All rights reserved.
+ *
+ */
+
+#ifndef __TRACE_H__
+#define __TRACE_H__
+
+/**************************************************
+ * Includes                                       *
+ **************************************************/
+
+#include <stdint.h>
+
+/**************************************************
+ * Macros                                         *
+ **************************************************/
+
+/* Events kept per thread; older events are overwritten */
+#define TRACE_EVENTS   65536
+
+/* Deepest nesting of open events */
+#define TRACE_DEPTH    8
+
+/* Most phases watched */
+#define TRACE_MAX_PHASES 8
+
+/**************************************************
+ * Globals                                        *
+ **************************************************/
+
+/* Nonzero while tracing */
+extern int trace_on;
+
+/* Timestep recorded with each event */
+extern int32_t trace_step;
+
+/**************************************************
+ * Function Prototypes                            *
+ **************************************************/
+
+void trace_init(int nthreads);
+
+void trace_watch(char* name);
+
+void trace_watch_begin(char* name);
+
+void trace_watch_end(char* name);
+
+void trace_push(char* name);
+
+void trace_pop();
+
+void write_trace(int nprocs);
+
+/**************************************************
+ * Inline fuctions                                *
+ **************************************************/
+
+/* Opens an event on the calling thread */
+static inline void trace_begin(char* name)
+{
+    if(trace_on) trace_push(name);
+}
+
+/* Closes the innermost open event on the calling thread */
+static inline void trace_end()
+{
+    if(trace_on) trace_pop();
+}
+
+/* Barrier whose waiting time is traced */
+static inline void trace_barrier()
+{
+    trace_begin("Wait");
+    #pragma omp barrier
+    trace_end();
+}
+
+#endif
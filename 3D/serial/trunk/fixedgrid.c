@@ -252,9 +252,9 @@ int main(int argc, char** argv)
         
         discretize_all_z(G, G->dt);
         
-        discretize_all_y(G, G->dt*05);
+        discretize_all_y(G, G->dt*0.5);
         
-        discretize_all_x(G, G->dt*05);
+        discretize_all_x(G, G->dt*0.5);
         
         /*
          * Could update wind field here...